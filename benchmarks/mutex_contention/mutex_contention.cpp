@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <mutex>
+#include "ffrt_inner.h"
+#include "common.h"
+
+constexpr uint32_t CONTENTION_TASK_NUM = 8;
+constexpr uint32_t LOCK_COUNT_PER_TASK = 100000;
+
+template <typename Mutex>
+void ContendedCounter(const char* info)
+{
+    Mutex mtx;
+    uint64_t counter = 0;
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < CONTENTION_TASK_NUM; i++) {
+            ffrt::submit([&]() {
+                for (uint32_t j = 0; j < LOCK_COUNT_PER_TASK; j++) {
+                    std::lock_guard lock(mtx);
+                    counter++;
+                }
+                simulate_task_compute_time(COMPUTE_TIME_US);
+            }, {}, {});
+        }
+        ffrt::wait();
+    }
+    TIME_END_INFO(t, info);
+    EXPECT(counter == static_cast<uint64_t>(REPEAT) * CONTENTION_TASK_NUM * LOCK_COUNT_PER_TASK);
+}
+
+int main()
+{
+    GetEnvs();
+    PreHotFFRT();
+    ContendedCounter<ffrt::mutex>("mutex_contention_ffrt_mutex");
+    ContendedCounter<std::mutex>("mutex_contention_std_mutex");
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include "ffrt_inner.h"
+#include "common.h"
+
+constexpr uint32_t PARALLEL_FOR_COUNT = 10000;
+constexpr uint32_t REDUCE_COUNT = 1000000;
+
+// same loop as fork_join, one task per iteration
+void ForkJoinPerIndex()
+{
+    PreHotFFRT();
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < PARALLEL_FOR_COUNT; i++) {
+            ffrt::submit([=]() { simulate_task_compute_time(COMPUTE_TIME_US); }, {}, {});
+        }
+        ffrt::wait();
+    }
+    TIME_END_INFO(t, "fork_join_per_index");
+}
+
+void ParallelFor()
+{
+    PreHotFFRT();
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        ffrt::parallel_for(0u, PARALLEL_FOR_COUNT, [](uint32_t) { simulate_task_compute_time(COMPUTE_TIME_US); });
+    }
+    TIME_END_INFO(t, "parallel_for");
+}
+
+void ParallelForWorker()
+{
+    PreHotFFRT();
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        ffrt::submit(
+            [&]() {
+                ffrt::parallel_for(0u, PARALLEL_FOR_COUNT,
+                    [](uint32_t) { simulate_task_compute_time(COMPUTE_TIME_US); });
+            },
+            {}, {&r});
+        ffrt::wait({&r});
+    }
+    TIME_END_INFO(t, "parallel_for_worker_submit");
+}
+
+// one task per chunk of the range, each adding its partial sum
+void ReduceChunked()
+{
+    PreHotFFRT();
+    uint32_t chunks = PARALLEL_FOR_COUNT / 10;
+    uint32_t chunkSize = REDUCE_COUNT / chunks;
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        std::atomic<uint64_t> sum {0};
+        for (uint32_t c = 0; c < chunks; c++) {
+            ffrt::submit([&, c]() {
+                uint64_t part = 0;
+                for (uint32_t i = c * chunkSize; i < (c + 1) * chunkSize; i++) {
+                    part += i;
+                }
+                sum.fetch_add(part, std::memory_order_relaxed);
+            }, {}, {});
+        }
+        ffrt::wait();
+        EXPECT(sum.load() == uint64_t(REDUCE_COUNT) * (REDUCE_COUNT - 1) / 2);
+    }
+    TIME_END_INFO(t, "reduce_chunk_tasks");
+}
+
+void ParallelReduce()
+{
+    PreHotFFRT();
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        uint64_t sum = ffrt::parallel_reduce(0u, REDUCE_COUNT, uint64_t(0),
+            [](uint32_t b, uint32_t e, uint64_t acc) {
+                for (uint32_t i = b; i < e; i++) {
+                    acc += i;
+                }
+                return acc;
+            },
+            [](uint64_t l, uint64_t r) { return l + r; }, 1024u);
+        EXPECT(sum == uint64_t(REDUCE_COUNT) * (REDUCE_COUNT - 1) / 2);
+    }
+    TIME_END_INFO(t, "parallel_reduce");
+}
+
+int main()
+{
+    GetEnvs();
+    ForkJoinPerIndex();
+    ParallelFor();
+    ParallelForWorker();
+    ReduceChunked();
+    ParallelReduce();
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ffrt_inner.h"
+#include "common.h"
+
+/*
+ * Harness for tuning the ordering of ready tasks: every workload below runs under every policy listed in main.
+ * To try a policy, implement ffrt::sched_policy and add it to the list.
+ */
+constexpr uint32_t FORK_JOIN_COUNT = 10000;
+
+class FifoPolicy : public ffrt::sched_policy {
+public:
+    void push(const ffrt::ready_task& task) override
+    {
+        tasks.push_back(task);
+    }
+
+    ffrt::ready_task pop() override
+    {
+        if (tasks.empty()) {
+            return {};
+        }
+        ffrt::ready_task task = tasks.front();
+        tasks.pop_front();
+        return task;
+    }
+
+    size_t size() const override
+    {
+        return tasks.size();
+    }
+
+private:
+    std::deque<ffrt::ready_task> tasks;
+};
+
+// newest first for cache locality, but helpers from other QoS take the oldest
+class LifoPolicy : public ffrt::sched_policy {
+public:
+    void push(const ffrt::ready_task& task) override
+    {
+        tasks.push_back(task);
+    }
+
+    ffrt::ready_task pop() override
+    {
+        if (tasks.empty()) {
+            return {};
+        }
+        ffrt::ready_task task = tasks.back();
+        tasks.pop_back();
+        return task;
+    }
+
+    ffrt::ready_task steal() override
+    {
+        if (tasks.empty()) {
+            return {};
+        }
+        ffrt::ready_task task = tasks.front();
+        tasks.pop_front();
+        return task;
+    }
+
+    size_t size() const override
+    {
+        return tasks.size();
+    }
+
+private:
+    std::deque<ffrt::ready_task> tasks;
+};
+
+struct Policy {
+    std::string name;
+    std::function<std::unique_ptr<ffrt::sched_policy>()> create;
+};
+
+void ForkJoin(const std::string& policy)
+{
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < FORK_JOIN_COUNT; i++) {
+            ffrt::submit([=]() { simulate_task_compute_time(COMPUTE_TIME_US); }, {}, {});
+        }
+        ffrt::wait();
+    }
+    TIME_END_INFO(t, (policy + "_fork_join").c_str());
+}
+
+void FibChildWait(int x, int& y)
+{
+    if (x <= 1) {
+        y = x;
+    } else {
+        int y1;
+        int y2;
+        ffrt::submit([&]() { FibChildWait(x - 1, y1); }, {}, {});
+        ffrt::submit([&]() { FibChildWait(x - 2, y2); }, {}, {});
+        ffrt::wait();
+        y = y1 + y2;
+    }
+    simulate_task_compute_time(COMPUTE_TIME_US);
+}
+
+void Fib(const std::string& policy)
+{
+    int output;
+    TIME_BEGIN(t);
+    for (uint64_t i = 0; i < REPEAT; ++i) {
+        ffrt::submit([&]() { FibChildWait(FIB_NUM, output); }, {}, {&output});
+        ffrt::wait({&output});
+    }
+    TIME_END_INFO(t, (policy + "_fib_child_wait").c_str());
+}
+
+int main()
+{
+    GetEnvs();
+    std::vector<Policy> policies = {
+        {"builtin", nullptr},
+        {"fifo", [] { return std::make_unique<FifoPolicy>(); }},
+        {"lifo", [] { return std::make_unique<LifoPolicy>(); }},
+    };
+    for (auto& policy : policies) {
+        ffrt::set_sched_policy(ffrt::qos_default, policy.create ? policy.create() : nullptr);
+        PreHotFFRT();
+        ForkJoin(policy.name);
+        Fib(policy.name);
+    }
+    ffrt::set_sched_policy(ffrt::qos_default, nullptr);
+}
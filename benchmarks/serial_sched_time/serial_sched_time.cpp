@@ -18,6 +18,34 @@
 
 static std::vector<uint32_t> duration_sample = {50, 60, 70, 80, 90, 100, 120, 140, 160, 180, 200, 500, 1000};
 
+constexpr uint32_t RUN_BUDGET_TASK_NUM = 64;
+constexpr uint64_t RUN_BUDGET_TIME_US = 2000;
+
+static inline void serial_queue(uint32_t count, uint32_t duration, bool withBudget, int64_t& time)
+{
+    ffrt_queue_attr_t attr;
+    (void)ffrt_queue_attr_init(&attr);
+    if (withBudget) {
+        ffrt_queue_attr_set_run_budget(&attr, RUN_BUDGET_TASK_NUM, RUN_BUDGET_TIME_US);
+    }
+    ffrt_queue_t queue = ffrt_queue_create(ffrt_queue_serial, "serial_sched_time", &attr);
+
+    std::function<void()> func = [duration]() { simulate_task_compute_time(duration); };
+    uint32_t loop = count - 1;
+    auto start = std::chrono::steady_clock::now();
+    while (loop--) {
+        ffrt_queue_submit(queue, ffrt::create_function_wrapper(func, ffrt_function_kind_queue), nullptr);
+    }
+    ffrt_task_handle_t handle =
+        ffrt_queue_submit_h(queue, ffrt::create_function_wrapper(func, ffrt_function_kind_queue), nullptr);
+    ffrt_queue_wait(handle);
+    time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ffrt_task_handle_destroy(handle);
+    ffrt_queue_destroy(queue);
+    ffrt_queue_attr_destroy(&attr);
+}
+
 int main()
 {
     int64_t ffrt_time;
@@ -32,6 +60,17 @@ int main()
         printf("completely serial count:%u duration:%u ffrt_time:%ld single_t_time:%ld "
                "sched_time:%.2f\n",
             count, duration_sample[i], ffrt_time, single_t_time, sched_time);
+
+        serial_queue(count, duration_sample[i], false, ffrt_time);
+        sched_time = (1.0f * ffrt_time - single_t_time) / count;
+        printf("serial queue count:%u duration:%u ffrt_time:%ld single_t_time:%ld sched_time:%.2f\n",
+            count, duration_sample[i], ffrt_time, single_t_time, sched_time);
+
+        serial_queue(count, duration_sample[i], true, ffrt_time);
+        sched_time = (1.0f * ffrt_time - single_t_time) / count;
+        printf("serial queue with run budget count:%u duration:%u ffrt_time:%ld single_t_time:%ld "
+               "sched_time:%.2f\n",
+            count, duration_sample[i], ffrt_time, single_t_time, sched_time);
     }
     return 0;
 }
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <string>
+#include "ffrt_inner.h"
+#include "common.h"
+
+constexpr uint32_t READ_COUNT_PER_TASK = 100000;
+static const std::vector<uint32_t> READER_NUM_SAMPLE = {1, 2, 4, 8, 16, 32, 64};
+
+void ReadScaling(bool readBiased, uint32_t readerNum)
+{
+    ffrt_rwlockattr_t attr;
+    ffrt_rwlockattr_init(&attr);
+    ffrt_rwlockattr_setreadbiased(&attr, readBiased);
+    ffrt_rwlock_t rwlock;
+    ffrt_rwlock_init(&rwlock, &attr);
+    uint64_t data = 1;
+    std::atomic<uint64_t> sum = 0;
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < readerNum; i++) {
+            ffrt::submit([&]() {
+                uint64_t local = 0;
+                for (uint32_t j = 0; j < READ_COUNT_PER_TASK; j++) {
+                    ffrt_rwlock_rdlock(&rwlock);
+                    local += data;
+                    ffrt_rwlock_unlock(&rwlock);
+                }
+                sum += local;
+            }, {}, {});
+        }
+        ffrt::wait();
+    }
+    std::string info = std::string(readBiased ? "shared_mutex_read_biased" : "shared_mutex_normal") +
+        "_readers_" + std::to_string(readerNum);
+    TIME_END_INFO(t, info.c_str());
+    EXPECT(sum == static_cast<uint64_t>(REPEAT) * readerNum * READ_COUNT_PER_TASK);
+
+    ffrt_rwlock_destroy(&rwlock);
+    ffrt_rwlockattr_destroy(&attr);
+}
+
+int main()
+{
+    GetEnvs();
+    PreHotFFRT();
+    for (auto readerNum : READER_NUM_SAMPLE) {
+        ReadScaling(false, readerNum);
+        ReadScaling(true, readerNum);
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include "ffrt_inner.h"
+#include "common.h"
+
+constexpr uint32_t FRAME_COUNT = 100;
+constexpr uint32_t STAGES = 20;
+constexpr uint32_t LANES = 10;
+
+// every task of a stage reads two neighbouring lanes of the stage before and writes its own lane
+struct Frame {
+    int data[STAGES][LANES] = {};
+    std::atomic<uint32_t> ran {0};
+};
+
+template <typename Submit>
+void BuildFrame(Frame& f, Submit&& submit)
+{
+    for (uint32_t s = 0; s < STAGES; s++) {
+        for (uint32_t l = 0; l < LANES; l++) {
+            auto fn = [&f]() {
+                simulate_task_compute_time(COMPUTE_TIME_US);
+                f.ran.fetch_add(1, std::memory_order_relaxed);
+            };
+            if (s == 0) {
+                submit(fn, std::vector<const void*> {}, std::vector<const void*> {&f.data[s][l]});
+            } else {
+                submit(fn, std::vector<const void*> {&f.data[s - 1][l], &f.data[s - 1][(l + 1) % LANES]},
+                    std::vector<const void*> {&f.data[s][l]});
+            }
+        }
+    }
+}
+
+void SubmitPerFrame()
+{
+    PreHotFFRT();
+    Frame f;
+
+    TIME_BEGIN(t);
+    for (uint32_t r = 0; r < REPEAT * FRAME_COUNT; r++) {
+        BuildFrame(f, [](const std::function<void()>& fn, const std::vector<const void*>& in,
+            const std::vector<const void*>& out) {
+            std::vector<ffrt::dependence> inDeps(in.begin(), in.end());
+            std::vector<ffrt::dependence> outDeps(out.begin(), out.end());
+            ffrt::submit(fn, inDeps, outDeps);
+        });
+        ffrt::wait();
+    }
+    TIME_END_INFO(t, "submit_per_frame");
+    EXPECT(f.ran.load() == REPEAT * FRAME_COUNT * STAGES * LANES);
+}
+
+void GraphLaunch()
+{
+    PreHotFFRT();
+    Frame f;
+
+    TIME_BEGIN(t);
+    ffrt::task_graph g;
+    BuildFrame(f, [&g](const std::function<void()>& fn, const std::vector<const void*>& in,
+        const std::vector<const void*>& out) { g.submit(fn, in, out); });
+    ffrt::graph_exec exec = g.instantiate();
+    for (uint32_t r = 0; r < REPEAT * FRAME_COUNT; r++) {
+        exec.launch();
+        exec.wait();
+    }
+    TIME_END_INFO(t, "graph_launch");
+    EXPECT(f.ran.load() == REPEAT * FRAME_COUNT * STAGES * LANES);
+}
+
+int main()
+{
+    GetEnvs();
+    SubmitPerFrame();
+    GraphLaunch();
+}
@@ -25,6 +25,8 @@
 #include "eu/co_routine.h"
 
 namespace ffrt {
+class TaskGroup;
+
 class task_attr_private {
 public:
     task_attr_private()
@@ -48,11 +50,15 @@ public:
     bool notifyWorker_ = true;
     bool isDelaying_ = false;
     ffrt_queue_priority_t prio_ = ffrt_queue_priority_low;
+    ffrt_task_priority_t taskPrio_ = ffrt_task_priority_normal;
+    uint64_t deadlineUs_ = 0;
+    uint64_t affinityHint_ = 0;
     bool taskLocal_ = false;
     bool headInsert_ = false;
     ffrt_function_header_t* timeoutCb_ = nullptr;
     uint64_t stackSize_ = STACK_SIZE;
     bool groupRoot_ = false;
+    TaskGroup* group_ = nullptr;
 };
 }
 #endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_CPU_PRESSURE_H
+#define FFRT_CPU_PRESSURE_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace ffrt {
+struct CpuPressureSample {
+    uint32_t stallPct = 0; // share of the sampling period some runnable task of the cgroup waited for a cpu
+    uint32_t runnable = 0; // tasks runnable on the whole system, including the running ones
+    uint32_t cpus = 0;
+};
+
+/*
+ * Samples the cpu pressure stall information (PSI) of the cgroup of the process, or of the whole system when the
+ * cgroup does not export it, together with the runqueue length of the whole system from /proc/loadavg.
+ */
+class CpuPressure {
+public:
+    CpuPressure();
+
+    bool Available() const
+    {
+        return !psiPath.empty();
+    }
+
+    // the first sample after construction only sets the baseline and returns false
+    bool Sample(CpuPressureSample& sample);
+
+private:
+    static bool ReadStallTotal(const std::string& path, uint64_t& totalUs);
+    static bool ReadRunnable(uint32_t& runnable);
+
+    std::string psiPath;
+    uint64_t lastTotalUs = 0;
+    std::chrono::steady_clock::time_point lastTime {};
+};
+} // namespace ffrt
+#endif
@@ -227,6 +227,7 @@ private:
     static void Dispatch(CPUWorker* worker);
     static void RunTask(TaskBase* task, CPUWorker* worker);
     static bool RunSingleTask(int qos, CPUWorker *worker);
+    void PushNextTask(ExecuteCtx* ctx);
 #ifdef FFRT_SEND_EVENT
     int cacheQos; // cache int qos
     std::string cacheLabel; // cache string label
@@ -30,6 +30,7 @@
 #include <array>
 #include "cpp/mutex.h"
 #include "eu/thread_group.h"
+#include "eu/cpu_pressure.h"
 #include "eu/cpu_worker.h"
 #include "sync/sync.h"
 #include "internal_inc/osal.h"
@@ -174,6 +175,12 @@ struct EscapeConfig {
     uint64_t twoStageWorkerNum_ = TWO_STAGE_WORKER_NUM;
 };
 
+struct PressureScalingConfig {
+    bool enable_ = false;
+    uint64_t intervalMs_ = 0;
+    uint32_t stallThresholdPct_ = 0;
+};
+
 class ExecuteUnit {
 public:
     static void RegistInsCb(SingleInsCB<ExecuteUnit>::Instance &&cb);
@@ -241,6 +248,10 @@ public:
 
     void SubmitEscape(int qos, uint64_t totalWorkerNum);
 
+    // worker pressure scaling
+    int SetPressureScalingEnable(uint64_t intervalMs, uint32_t stallThresholdPct);
+    void SetPressureScalingDisable();
+
     inline uint64_t GetWorkerNum()
     {
         return workerNum.load();
@@ -369,6 +380,20 @@ private:
     WaitUntilEntry *we_[QoS::MaxNum()] = {nullptr};
     virtual void ExecuteEscape(int qos) = 0;
 
+    // worker pressure scaling, guarded by pressureMutex
+    std::mutex pressureMutex;
+    PressureScalingConfig pressureConfig;
+    std::unique_ptr<CpuPressure> cpuPressure;
+    size_t baseConcurrency[QoS::MaxNum()] = {};
+    // the limit last written by the scaler, a group holding another one had its limit set by the user
+    size_t scaledConcurrency[QoS::MaxNum()] = {};
+    bool pressureTickPending = false;
+    WaitUntilEntry *pressureWe = nullptr;
+    bool SubmitPressureTick();
+    void PressureTick();
+    void AdjustConcurrencyByPressure(const CpuPressureSample& sample);
+    void RestoreConcurrency();
+
     inline uint64_t CalEscapeInterval(uint16_t totalWorkerNum)
     {
         if (totalWorkerNum < escapeConfig.oneStageWorkerNum_) {
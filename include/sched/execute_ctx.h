@@ -63,6 +63,7 @@ enum class WaitEntryStatus {
 
 class TaskBase;
 class CoTask;
+class mutexBase;
 
 struct WaitEntry {
     WaitEntry() : prev(this), next(this), task(nullptr), wtType(SharedMutexWaitType::NORMAL) {
@@ -90,6 +91,9 @@ struct WaitUntilEntry : WaitEntry {
     std::function<void(WaitEntry*)> cb;
     std::mutex wl;
     std::condition_variable cv;
+    mutexBase* mtx = nullptr; // mutex released by an untimed condition variable wait
+    bool requeued = false; // moved to the wait list of mtx by notify instead of being woken
+    bool woken = false; // set under wl when a thread waiting on an untimed wait is woken
 };
 // 当前Worker线程的状态信息
 struct ExecuteCtx {
@@ -102,6 +106,9 @@ struct ExecuteCtx {
     uint64_t lastGid_ = 0;
     pid_t tid;
     ThreadType threadType_ = ffrt::ThreadType::USER_THREAD;
+    uint64_t intervalDeadlineUs = 0; // absolute deadline of the interval begun or joined on this thread
+    bool collectNextTask = false; // set on a worker while a task is done, see CPUEUTask::Ready
+    TaskBase* nextTask = nullptr; // readied by the task just done, run next by this worker
 
     static FFRT_NOINLINE void* CreateExecuteCtx()
     {
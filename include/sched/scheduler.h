@@ -68,6 +68,19 @@ public:
         return task;
     }
 
+    TaskBase* StealTask(const QoS& qos)
+    {
+        if (tearDown) {
+            return nullptr;
+        }
+
+        TaskBase* task = taskSchedulers[qos]->StealTask();
+        if (task) {
+            task->Pop();
+        }
+        return task;
+    }
+
     inline uint64_t GetTotalTaskCnt(const QoS& qos)
     {
         return taskSchedulers[static_cast<unsigned short>(qos)]->GetTotalTaskCnt();
@@ -90,9 +103,6 @@ public:
 
     bool CancelUVWork(ffrt_executor_task_t* uvWork, int qos);
 
-    bool CheckUVTaskConcurrency(ffrt_executor_task_t* task, const QoS& qos);
-    ffrt_executor_task_t* PickWaitingUVTask(const QoS& qos);
-
     std::atomic_bool tearDown { false };
 
 private:
@@ -16,6 +16,8 @@
 #ifndef FFRT_TASK_RUNQUEUE_HPP
 #define FFRT_TASK_RUNQUEUE_HPP
 
+#include <algorithm>
+#include <vector>
 #include "internal_inc/osal.h"
 #include "tm/cpu_task.h"
 
@@ -79,6 +81,259 @@ private:
     LinkedList list;
     std::atomic<int> size = 0;
 };
+
+/*
+ * Tasks of one priority with an affinity hint in submission order. A worker takes the first of the leading
+ * SCAN_LIMIT tasks whose hint holds its cpu. The hint is ignored and the head task taken when no other task of
+ * the priority is ready, when the head has been passed over AGING_LIMIT times, or when more than BACKLOG_LIMIT
+ * hinted tasks pile up because the preferred cpus are busy.
+ */
+class AffinityHintQueue {
+public:
+    static bool Hits(uint64_t hint, int cpu)
+    {
+        return cpu >= 0 && cpu < HINT_CPU_NUM && ((hint >> cpu) & 1) != 0;
+    }
+
+    void EnQueue(TaskBase* task)
+    {
+        list.PushBack(task->node);
+        size.store(size.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // returns nullptr if no task is preferred by the cpu and the hint is still worth honoring
+    TaskBase* DeQueue(int cpu, bool othersEmpty)
+    {
+        if (list.Empty()) {
+            return nullptr;
+        }
+        LinkedList* node = list.Next();
+        if (othersEmpty || skipped >= AGING_LIMIT || size.load(std::memory_order_relaxed) > BACKLOG_LIMIT) {
+            return Remove(node);
+        }
+        for (uint32_t i = 0; i < SCAN_LIMIT && node != &list; i++) {
+            if (Hits(node->ContainerOf(&TaskBase::node)->affinityHint_, cpu)) {
+                skipped += (i > 0) ? 1 : 0;
+                return Remove(node);
+            }
+            node = LinkedList::Next(node);
+        }
+        skipped++;
+        return nullptr;
+    }
+
+    bool Empty()
+    {
+        return list.Empty();
+    }
+
+    int Size()
+    {
+        return size.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int HINT_CPU_NUM = 64;
+    static constexpr uint32_t SCAN_LIMIT = 8;
+    static constexpr uint32_t AGING_LIMIT = 8;
+    static constexpr int BACKLOG_LIMIT = 64;
+
+    TaskBase* Remove(LinkedList* node)
+    {
+        if (node == list.Next()) {
+            skipped = 0;
+        }
+        LinkedList::Delete(node);
+        size.store(size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        return node->ContainerOf(&TaskBase::node);
+    }
+
+    LinkedList list;
+    std::atomic<int> size = 0;
+    uint32_t skipped = 0;
+};
+
+/*
+ * FIFO queues for the priorities of one QoS. The highest non-empty priority is dequeued first, except that a
+ * non-empty priority passed over AGING_LIMIT times in a row is dequeued next, so it cannot starve. Tasks run
+ * from outside these queues instead, such as those queued by deadline, count as passing over every priority.
+ * Within a priority, a task whose affinity hint holds the cpu of the popping worker goes first, except that
+ * the tasks without a hint passed over AGING_LIMIT times in a row are dequeued next.
+ */
+class PriorityFIFOQueue {
+public:
+    void EnQueue(TaskBase* task)
+    {
+        uint8_t prio = task->schedPrio_ < PRIO_NUM ? task->schedPrio_ : static_cast<uint8_t>(ffrt_task_priority_normal);
+        if (task->affinityHint_ != 0) {
+            hinted[prio].EnQueue(task);
+            hintedSize.store(hintedSize.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            ques[prio].EnQueue(task);
+        }
+    }
+
+    // cpu is the one of the popping worker, -1 if unknown
+    TaskBase* DeQueue(int cpu = -1)
+    {
+        int chosen = -1;
+        for (int i = 0; i < PRIO_NUM; i++) {
+            if (!BandEmpty(i)) {
+                chosen = i;
+                break;
+            }
+        }
+        if (chosen < 0) {
+            return nullptr;
+        }
+        int aged = -1;
+        for (int i = chosen + 1; i < PRIO_NUM; i++) {
+            if (BandEmpty(i)) {
+                skipped[i] = 0;
+                continue;
+            }
+            if (++skipped[i] > AGING_LIMIT && aged < 0) {
+                aged = i;
+            }
+        }
+        if (aged >= 0) {
+            chosen = aged;
+        }
+        skipped[chosen] = 0;
+        return DeQueueBand(chosen, cpu);
+    }
+
+    // called when a task from elsewhere is about to run instead, returns whether a priority is due to go next
+    bool PassOver()
+    {
+        bool due = false;
+        for (int i = 0; i < PRIO_NUM; i++) {
+            if (BandEmpty(i)) {
+                skipped[i] = 0;
+                continue;
+            }
+            if (++skipped[i] > AGING_LIMIT) {
+                due = true;
+            }
+        }
+        return due;
+    }
+
+    bool Empty()
+    {
+        for (int i = 0; i < PRIO_NUM; i++) {
+            if (!BandEmpty(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int Size()
+    {
+        int total = 0;
+        for (int i = 0; i < PRIO_NUM; i++) {
+            total += ques[i].Size() + hinted[i].Size();
+        }
+        return total;
+    }
+
+    // whether a task with an affinity hint is queued, may be called without the queue lock
+    bool HintedQueued()
+    {
+        return hintedSize.load(std::memory_order_relaxed) > 0;
+    }
+
+    // whether a task of a higher priority than prio is queued, may be called without the queue lock
+    bool HigherQueued(uint8_t prio)
+    {
+        for (int i = 0; i < PRIO_NUM && i < prio; i++) {
+            if (ques[i].Size() > 0 || hinted[i].Size() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static constexpr int PRIO_NUM = ffrt_task_priority_low + 1;
+    static constexpr uint32_t AGING_LIMIT = 8;
+
+    bool BandEmpty(int prio)
+    {
+        return ques[prio].Empty() && hinted[prio].Empty();
+    }
+
+    TaskBase* DeQueueBand(int prio, int cpu)
+    {
+        if (hinted[prio].Empty()) {
+            return ques[prio].DeQueue();
+        }
+        TaskBase* task = nullptr;
+        if (ques[prio].Empty()) {
+            task = hinted[prio].DeQueue(cpu, true);
+        } else if (unhintedSkipped[prio] < AGING_LIMIT) {
+            task = hinted[prio].DeQueue(cpu, false);
+        }
+        if (task == nullptr) {
+            unhintedSkipped[prio] = 0;
+            return ques[prio].DeQueue();
+        }
+        unhintedSkipped[prio] += ques[prio].Empty() ? 0 : 1;
+        hintedSize.store(hintedSize.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        return task;
+    }
+
+    FIFOQueue ques[PRIO_NUM];
+    AffinityHintQueue hinted[PRIO_NUM];
+    uint32_t unhintedSkipped[PRIO_NUM] = {0};
+    std::atomic<int> hintedSize = 0;
+    uint32_t skipped[PRIO_NUM] = {0};
+};
+
+// tasks with a deadline, earliest deadline first, then in submission order
+class EDFQueue {
+public:
+    void EnQueue(TaskBase* task)
+    {
+        heap.push_back(task);
+        std::push_heap(heap.begin(), heap.end(), Later());
+        size.store(static_cast<int>(heap.size()), std::memory_order_relaxed);
+    }
+
+    TaskBase* DeQueue()
+    {
+        if (heap.empty()) {
+            return nullptr;
+        }
+        std::pop_heap(heap.begin(), heap.end(), Later());
+        TaskBase* task = heap.back();
+        heap.pop_back();
+        size.store(static_cast<int>(heap.size()), std::memory_order_relaxed);
+        return task;
+    }
+
+    bool Empty()
+    {
+        return size.load(std::memory_order_relaxed) == 0;
+    }
+
+    int Size()
+    {
+        return size.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Later {
+        bool operator()(const TaskBase* l, const TaskBase* r) const
+        {
+            return l->deadlineUs_ != r->deadlineUs_ ? l->deadlineUs_ > r->deadlineUs_ : l->gid > r->gid;
+        }
+    };
+
+    std::vector<TaskBase*> heap;
+    std::atomic<int> size = 0;
+};
 } // namespace ffrt
 
 #endif
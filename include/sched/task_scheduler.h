@@ -16,8 +16,11 @@
 #ifndef FFRT_TASK_SCHEDULER_HPP
 #define FFRT_TASK_SCHEDULER_HPP
 #include <deque>
+#include <memory>
+#include "cpp/sched_policy.h"
 #include "sched/task_runqueue.h"
 #include "tm/task_base.h"
+#include "util/mpsc_queue.h"
 #include "util/spmc_queue.h"
 #include "tm/uv_task.h"
 
@@ -31,6 +34,12 @@ public:
 
     virtual TaskBase* PopTask() = 0;
 
+    // pops on behalf of a worker of another QoS
+    virtual TaskBase* StealTask()
+    {
+        return PopTask();
+    }
+
     virtual void SetQos(QoS &q) = 0;
 
     int qos {0};
@@ -49,10 +58,38 @@ public:
     // global_queue is empty?
     virtual bool GlobalTaskEmpty() = 0;
 
-    bool CancelUVWork(ffrt_executor_task_t* uvWork);
-    bool PushUVTaskToWaitingQueue(UVTask* task);
-    bool CheckUVTaskConcurrency(UVTask* task);
-    UVTask* PickWaitingUVTask();
+    // returns false if the policy is not supported
+    virtual bool SetPolicy(ffrt_sched_policy policy)
+    {
+        return policy == ffrt_sched_policy_fifo;
+    }
+
+    // replaces the built-in run queue, nullptr restores it; returns false if not supported
+    virtual bool SetCustomPolicy(std::unique_ptr<sched_policy> policy)
+    {
+        return policy == nullptr;
+    }
+
+    // whether a task readied by a finished task may run next on that worker instead of going through the queue
+    virtual bool CanRunNext(TaskBase* task)
+    {
+        (void)task;
+        return true;
+    }
+
+    std::atomic<uint64_t> deadlineMissCnt {0};
+    std::atomic<uint64_t> affinityHintCnt {0}; // executed tasks with an affinity hint
+    std::atomic<uint64_t> affinityHintHitCnt {0}; // the ones run on a cpu of their hint
+
+    static bool CancelUVWork(ffrt_executor_task_t* uvWork);
+    // waits for the cancels which may still access the task through its uvWork
+    static void WaitUVCancelDone(const ffrt_executor_task_t* uvWork);
+
+    // returns the task to push to the run queue, nullptr if the task is put in the waiting list
+    UVTask* AcquireUVPermit(UVTask* task);
+    // returns a claimed waiting task taking over the permit of the caller, nullptr if the permit is released
+    UVTask* ReleaseUVPermit();
+    void SetUVTaskMaxConcurrency(uint32_t num);
 
     inline bool IsStealerActive()
     {
@@ -60,23 +97,19 @@ public:
     }
 
 protected:
-    FFRT_NOINLINE void RemoveUVTaskSlowPath(UVTask* uvTask)
+    FFRT_NOINLINE TaskBase* RemoveUVTaskSlowPath(UVTask* uvTask)
     {
-        auto it = cancelSet_.find(uvTask->uvWork);
         uvTask->FreeMem();
-        cancelSet_.erase(it);
+        // the cancelled task held a permit
+        return ReleaseUVPermit();
     }
 
     TaskBase* GetUVTask(TaskBase* task)
     {
-        std::lock_guard<std::mutex> lg(uvMtx);
         UVTask* uvTask = static_cast<UVTask*>(task);
-        if FFRT_UNLIKELY(cancelSet_.find(uvTask->uvWork) != cancelSet_.end()) {
-            RemoveUVTaskSlowPath(uvTask);
-            return nullptr;
+        if FFRT_UNLIKELY(!uvTask->TryClaim()) {
+            return RemoveUVTaskSlowPath(uvTask);
         }
-
-        uvTask->SetDequeued();
         return task;
     }
 
@@ -84,10 +117,20 @@ protected:
     std::mutex* mtx {nullptr}; // global sched mutex(per qos) shared with EU and Scheduler
 
 private:
-    std::mutex uvMtx;
-    std::set<ffrt_executor_task_t*> cancelSet_;
-    int uvTaskConcurrency_ = 0;
-    std::deque<UVTask*> uvTaskWaitingQueue_;
+    static constexpr int UV_TASK_MAX_CONCURRENCY = 8;
+    static constexpr int UV_CANCEL_GUARD_NUM = 64;
+
+    bool TryAcquireUVPermit();
+    UVTask* PopWaitingUVTask();
+
+    // a UV task holds a permit from the run queue to its completion, waiting ones hold none
+    std::atomic<int> uvRunning_ {0};
+    std::atomic<int> uvLimit_ {UV_TASK_MAX_CONCURRENCY};
+    std::atomic<int> uvWaitingCnt_ {0};
+    std::mutex uvPopMtx_; // serializes the consumers of the waiting list, taken only when the limit is reached
+    MpscQueue uvWaitingList_;
+    // cancels in progress, hashed by uvWork
+    static inline std::atomic<int> uvCancelling_[UV_CANCEL_GUARD_NUM] {};
     std::atomic<bool> stealingInProgress { false }; /* indicates whether a stealer is in progress or not */
 };
 
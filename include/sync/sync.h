@@ -21,6 +21,8 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
+#include <time.h>
 #include <unistd.h>
 #include <sys/syscall.h>
 #include <linux/futex.h>
@@ -56,5 +58,42 @@ public:
 bool DelayedWakeup(const TimePoint& to, WaitEntry* we, const std::function<void(WaitEntry*)>& wakeup,
     bool skipTimeCheck = false);
 bool DelayedRemove(const TimePoint& to, WaitEntry* we);
+
+/*
+ * Parks the current thread or task on a wait list until a waker pops it or the time point is reached.
+ * Called with wlock held and returns with it released. push puts the entry of the waiter on the list and returns
+ * the node it used; wakers pop nodes under wlock and wake them as usual, through the cv of ExecuteCtx::wn for
+ * threads and CoWake for tasks. Returns false on timeout, once the node has been taken off the list, so that a
+ * timed out waiter never swallows a wakeup.
+ */
+bool TimedPark(fast_mutex& wlock, const TimePoint& tp, const std::function<LinkedList*(WaitEntry&)>& push);
+
+// entry of a waiter parked by ParkWait, it lives on the stack of the waiter and is invalid once it is woken
+struct ParkEntry {
+    LinkedList node;
+    ExecuteCtx* ctx = nullptr;
+    TaskBase* task = nullptr;
+    bool threadWait = false;
+    bool woken = false;
+};
+
+/*
+ * Parks the current thread or task on a wait list until a waker pops its entry and calls ParkWake. Takes wlock
+ * and returns false without parking if ready() holds under it. Otherwise push puts the entry on the list, and
+ * wlock is only released once the waiter can no longer miss the wakeup. trace is called before a task suspends.
+ */
+bool ParkWait(fast_mutex& wlock, ParkEntry& entry, const std::function<bool()>& ready,
+    const std::function<void(ParkEntry&)>& push, void (*trace)(uint64_t gid));
+
+// wakes up an entry popped off its wait list, called with wlock held and returns with it released
+void ParkWake(fast_mutex& wlock, ParkEntry* entry);
+
+// the time points of the C APIs are absolute times of the steady clock
+inline TimePoint ToTimePoint(const struct timespec& ts)
+{
+    using namespace std::chrono;
+    auto duration = seconds{ ts.tv_sec } + nanoseconds{ ts.tv_nsec };
+    return TimePoint { duration_cast<steady_clock::duration>(duration_cast<nanoseconds>(duration)) };
+}
 } // namespace ffrt
 #endif
@@ -43,6 +43,7 @@ constexpr int CO_CREATE_RETRY_INTERVAL = 500 * 1000;
 constexpr uint64_t MASK_FOR_HCS_TASK = 0xFF000000000000;
 struct VersionCtx;
 class SCPUEUTask;
+class TaskGroup;
 
 #ifdef FFRT_TASK_LOCAL_ENABLE
 struct TaskLocalAttr {
@@ -69,7 +70,9 @@ public:
     bool isWatchdogEnable = false;
     bool notifyWorker_ = true;
     bool isDelaying = false;
+    bool deadlineOwner_ = false; // a deadline inherited from the parent task is missed by its owner only
     ffrt_function_header_t* timeoutCb_ = nullptr;
+    TaskGroup* group_ = nullptr;
 
 #ifdef FFRT_TASK_LOCAL_ENABLE
     TaskLocalAttr* tlsAttr = nullptr;
@@ -147,6 +147,9 @@ public:
     std::atomic<uint64_t> statusTime = TimeStampCntvct();
     std::atomic<AliveStatus> aliveStatus {AliveStatus::UNITINITED};
     bool monitorTimeout_ = true;
+    uint8_t schedPrio_ = ffrt_task_priority_normal; // band of the QoS run queue, only set for normal tasks
+    uint64_t deadlineUs_ = 0; // absolute steady clock deadline, 0 if none, only set for normal tasks
+    uint64_t affinityHint_ = 0; // bit n set if the task prefers cpu n, 0 if none, only set for normal tasks
 
 #ifdef FFRT_ASYNC_STACKTRACE
     uint64_t stackId = 0;
@@ -20,6 +20,7 @@
 #include "c/executor_task.h"
 #include "core/task_attr_private.h"
 #include "tm/task_factory.h"
+#include "util/mpsc_queue.h"
 #ifdef USE_OHOS_QOS
 #include "qos.h"
 #else
@@ -27,6 +28,12 @@
 #endif
 
 namespace ffrt {
+enum class UVTaskState : uint8_t {
+    QUEUED,
+    CLAIMED,
+    CANCELLED,
+};
+
 class UVTask : public TaskBase {
 public:
     UVTask(ffrt_executor_task* uvWork, const task_attr_private *attr)
@@ -47,6 +54,7 @@ public:
         }
     }
     ffrt_executor_task* uvWork;
+    MpscNode waitNode;
 
     void Prepare() override {}
 
@@ -68,10 +76,7 @@ public:
     void Finish() override {}
     void Cancel() override {}
 
-    void FreeMem() override
-    {
-        TaskFactory<UVTask>::Free(this);
-    }
+    void FreeMem() override;
 
     void SetQos(const QoS& newQos) override
     {
@@ -99,14 +104,52 @@ public:
             目前由于已组合进入UVTask类型，不再作为链表节点，此处就可以使用uvWorker的wq来标记任务是否已经出队的状态。
             libuv里面，在cancel时也会判断任务是否已经出队（uv__queue_empty）:
             q== q->next || q != q->next->prev;其中next对应wq[0]，prev对应wq[1]
-            将wq出队，即可满足v__queue_empty返回false的需要
+            将wq指向自身，即可满足uv__queue_empty返回true的需要；cancel会无锁读取wq[0]，因此使用原子写
         */
-        LinkedList::RemoveCur(reinterpret_cast<LinkedList*>(&uvWork->wq));
+        __atomic_store_n(&uvWork->wq[0], &uvWork->wq, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&uvWork->wq[1], &uvWork->wq, __ATOMIC_SEQ_CST);
+    }
+
+    // a worker taking the task and a cancel race on the state, whoever moves it out of QUEUED owns the task
+    inline bool TryClaim()
+    {
+        UVTaskState exp = UVTaskState::QUEUED;
+        if (state_.compare_exchange_strong(exp, UVTaskState::CLAIMED)) {
+            SetDequeued();
+            return true;
+        }
+        // claimed already when handed over from the waiting list
+        return exp == UVTaskState::CLAIMED;
+    }
+
+    inline bool TryCancel()
+    {
+        UVTaskState exp = UVTaskState::QUEUED;
+        if (!state_.compare_exchange_strong(exp, UVTaskState::CANCELLED)) {
+            return false;
+        }
+        SetDequeued();
+        return true;
+    }
+
+    // the task queued with uvWork, nullptr once it is dequeued
+    static inline UVTask* FromWork(ffrt_executor_task* uvWork)
+    {
+        void* link = __atomic_load_n(&uvWork->wq[0], __ATOMIC_SEQ_CST);
+        if (link == nullptr || link == &uvWork->wq) {
+            return nullptr;
+        }
+        return LinkedList::ContainerOf(static_cast<LinkedList*>(link), &UVTask::uvWorkList);
     }
 
     static void ExecuteImpl(UVTask* task, ffrt_executor_task_func func);
+    // pushes a task holding a permit of its QoS to the run queue
+    static void PushReady(UVTask* task);
 private:
+    static void DropImpl(UVTask* task);
+
     LinkedList uvWorkList;
+    std::atomic<UVTaskState> state_ {UVTaskState::QUEUED};
 };
 } /* namespace ffrt */
 #endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_MPSC_QUEUE_H
+#define FFRT_MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace ffrt {
+struct MpscNode {
+    std::atomic<MpscNode*> next {nullptr};
+};
+
+/*
+ * Intrusive multi-producer single-consumer queue (Vyukov). Push is wait-free and may run concurrently with
+ * everything; Pop must be serialized by the caller. Pop returns nullptr while the only pending push is half
+ * done, so callers counting the nodes pushed must retry instead of treating that as empty.
+ */
+class MpscQueue {
+public:
+    MpscQueue() : head(&stub), tail(&stub)
+    {
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void Push(MpscNode* node) noexcept
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        MpscNode* prev = head.exchange(node);
+        prev->next.store(node);
+    }
+
+    MpscNode* Pop() noexcept
+    {
+        MpscNode* cur = tail;
+        MpscNode* next = cur->next.load();
+        if (cur == &stub) {
+            if (next == nullptr) {
+                return nullptr;
+            }
+            tail = next;
+            cur = next;
+            next = next->next.load();
+        }
+        if (next != nullptr) {
+            tail = next;
+            return cur;
+        }
+        if (cur != head.load()) {
+            return nullptr;
+        }
+        // cur is the last node, put the stub behind it so that it can be taken
+        Push(&stub);
+        next = cur->next.load();
+        if (next != nullptr) {
+            tail = next;
+            return cur;
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    T* Pop(MpscNode T::*member) noexcept
+    {
+        MpscNode* node = Pop();
+        if (node == nullptr) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(reinterpret_cast<intptr_t>(node) -
+            reinterpret_cast<intptr_t>(&(reinterpret_cast<T*>(0)->*member)));
+    }
+
+private:
+    std::atomic<MpscNode*> head;
+    MpscNode* tail;
+    MpscNode stub;
+};
+} // namespace ffrt
+#endif
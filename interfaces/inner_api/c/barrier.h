@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_INNER_API_C_BARRIER_H
+#define FFRT_INNER_API_C_BARRIER_H
+
+#include "c/type_def_ext.h"
+
+/**
+ * @brief Initializes a single-use latch.
+ *
+ * Waiting on the latch suspends the calling task instead of its worker thread.
+ *
+ * @param latch Indicates a pointer to the latch.
+ * @param count Indicates the number of count downs releasing the waiters.
+ * @return Returns <b>ffrt_success</b> if the latch is initialized;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_latch_init(ffrt_latch_t* latch, uint32_t count);
+
+/**
+ * @brief Decrements the counter of a latch, waking up all waiters once it reaches zero.
+ *
+ * @param latch Indicates a pointer to the latch.
+ * @param n Indicates the value to decrement the counter by.
+ * @return Returns <b>ffrt_success</b> if the counter is decremented;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_latch_count_down(ffrt_latch_t* latch, uint32_t n);
+
+/**
+ * @brief Checks whether the counter of a latch has reached zero.
+ *
+ * @param latch Indicates a pointer to the latch.
+ * @return Returns <b>ffrt_success</b> if the counter is zero;
+           returns <b>ffrt_error_busy</b> if the counter is not zero;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_latch_try_wait(ffrt_latch_t* latch);
+
+/**
+ * @brief Waits until the counter of a latch reaches zero.
+ *
+ * @param latch Indicates a pointer to the latch.
+ * @return Returns <b>ffrt_success</b> if the counter is zero;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_latch_wait(ffrt_latch_t* latch);
+
+/**
+ * @brief Decrements the counter of a latch and waits until it reaches zero.
+ *
+ * @param latch Indicates a pointer to the latch.
+ * @param n Indicates the value to decrement the counter by.
+ * @return Returns <b>ffrt_success</b> if the counter is zero;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_latch_arrive_and_wait(ffrt_latch_t* latch, uint32_t n);
+
+/**
+ * @brief Destroys a latch.
+ *
+ * @param latch Indicates a pointer to the latch.
+ * @return Returns <b>ffrt_success</b> if the latch is destroyed;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_latch_destroy(ffrt_latch_t* latch);
+
+/**
+ * @brief Initializes a reusable barrier.
+ *
+ * Once the expected number of participants arrive, all of them are released and the barrier moves to the next
+ * phase. Waiting on the barrier suspends the calling task instead of its worker thread.
+ *
+ * @param barrier Indicates a pointer to the barrier.
+ * @param count Indicates the number of participants, which must be greater than zero.
+ * @return Returns <b>ffrt_success</b> if the barrier is initialized;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_barrier_init(ffrt_barrier_t* barrier, uint32_t count);
+
+/**
+ * @brief Arrives at a barrier and waits until all participants of the current phase arrive.
+ *
+ * @param barrier Indicates a pointer to the barrier.
+ * @return Returns <b>ffrt_success</b> if the phase is completed;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_barrier_arrive_and_wait(ffrt_barrier_t* barrier);
+
+/**
+ * @brief Arrives at a barrier without waiting, and removes the caller from the participants of later phases.
+ *
+ * @param barrier Indicates a pointer to the barrier.
+ * @return Returns <b>ffrt_success</b> if the caller has arrived;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_barrier_arrive_and_drop(ffrt_barrier_t* barrier);
+
+/**
+ * @brief Destroys a barrier.
+ *
+ * @param barrier Indicates a pointer to the barrier.
+ * @return Returns <b>ffrt_success</b> if the barrier is destroyed;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_barrier_destroy(ffrt_barrier_t* barrier);
+
+#endif
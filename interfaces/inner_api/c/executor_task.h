@@ -76,6 +76,17 @@ FFRT_C_API void ffrt_executor_task_submit(ffrt_executor_task_t* task, const ffrt
  */
 FFRT_C_API int ffrt_executor_task_cancel(ffrt_executor_task_t* task, const ffrt_qos_t qos);
 
+/**
+ * @brief Sets the maximum number of UV tasks of a QoS running at the same time.
+ *
+ * UV tasks submitted beyond the limit wait in submission order. The default limit is 8.
+ *
+ * @param qos Indicates the QoS.
+ * @param num Indicates the maximum number of running UV tasks, which must be greater than 0.
+ * @return Returns ffrt_success if the limit is set; returns ffrt_error_inval otherwise.
+ */
+FFRT_C_API int ffrt_executor_task_set_max_concurrency(ffrt_qos_t qos, uint32_t num);
+
 /**
  * @brief Wakeups the ffrt poller.
  *
@@ -24,7 +24,9 @@ typedef enum {
     DUMP_INFO_ALL = 0,
     DUMP_TASK_STATISTIC_INFO,
     DUMP_START_STAT,
-    DUMP_STOP_STAT
+    DUMP_STOP_STAT,
+    DUMP_LOCK_CONTENTION_INFO,
+    DUMP_AFFINITY_HINT_INFO
 } ffrt_dump_cmd_t;
 
 typedef struct ffrt_stat {
@@ -45,6 +47,8 @@ typedef uint64_t (*CollectAsyncStackFunc)(uint64_t taskType);
  * @param cmd 命令类型：
  *            DUMP_INFO_ALL:表示输出所有信息
  *            DUMP_TASK_STATISTIC_INFO:输出任务统计信息
+ *            DUMP_LOCK_CONTENTION_INFO:输出mutex、shared_mutex、condition_variable的锁竞争采样信息
+ *            DUMP_AFFINITY_HINT_INFO:输出各QoS带亲和性提示任务的执行数及在提示CPU上执行的命中率
  * @param buf 指向需要写入的buffer
  * @param len buffer大小
  * @return 写入buffer的字符数，不包含字符串的结尾符号\0
@@ -72,6 +76,15 @@ FFRT_C_API uint32_t ffrt_task_timeout_get_threshold(void);
  * @since 10
  */
 FFRT_C_API void ffrt_task_timeout_set_threshold(uint32_t threshold_ms);
+/**
+ * @brief Set the sample rate of the lock contention profiler.
+ *
+ * One in every rate lock calls of a thread is profiled, the default rate is 64.
+ * Setting the rate to 0 stops sampling, the samples already taken can still be dumped.
+ *
+ * @param rate sample rate of the lock contention profiler.
+ */
+FFRT_C_API void ffrt_lock_profile_set_sample_rate(uint32_t rate);
 FFRT_C_API void FFRTSetAsyncStackFunc(CollectAsyncStackFunc collectAsyncStackFunc, SetStackIdFunc setStackIdFunc);
 FFRT_C_API void FFRTSetAsyncStackReleaseFunc(SetStackIdFunc releaseFunc);
 #endif /* FFRT_API_C_FFRT_DUMP_H */
\ No newline at end of file
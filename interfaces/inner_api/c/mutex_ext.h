@@ -16,6 +16,9 @@
 #ifndef FFRT_INNER_API_C_MUTEX_EXT_H
 #define FFRT_INNER_API_C_MUTEX_EXT_H
 
+#include <stdbool.h>
+#include "c/type_def.h"
+
 /**
  * @brief Locks a mutex through the slow path.
  *
@@ -36,4 +39,28 @@ FFRT_C_API int ffrt_mutex_lock_wait(ffrt_mutex_t* mutex);
  */
 FFRT_C_API int ffrt_mutex_unlock_wake(ffrt_mutex_t* mutex);
 
+/**
+ * @brief Sets the fair mode of a mutex attribute, only normal mutexes support it.
+ *
+ * In fair mode, once the longest waiter has waited for more than 1ms, the mutex is handed over to it directly
+ * on unlock, so that it cannot be starved by tasks barging in. ffrt_mutex_init rejects an attribute that is
+ * both fair and recursive.
+ *
+ * @param attr Indicates a pointer to the mutex attribute.
+ * @param fair Indicates whether the fair mode is enabled.
+ * @return Returns <b>ffrt_success</b> if the fair mode is set;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_mutexattr_setfair(ffrt_mutexattr_t* attr, bool fair);
+
+/**
+ * @brief Obtains the fair mode of a mutex attribute.
+ *
+ * @param attr Indicates a pointer to the mutex attribute.
+ * @param fair Indicates a pointer to the fair mode.
+ * @return Returns <b>ffrt_success</b> if the fair mode is obtained;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_mutexattr_getfair(const ffrt_mutexattr_t* attr, bool* fair);
+
 #endif
\ No newline at end of file
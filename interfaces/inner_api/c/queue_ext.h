@@ -142,4 +142,32 @@ FFRT_C_API void* ffrt_get_current_queue_eventhandler(void);
  */
 FFRT_C_API int ffrt_concurrent_queue_wait_all(ffrt_queue_t queue);
 
+/**
+ * @brief Sets the run-to-completion budget of a serial queue.
+ *
+ * The worker that executes the queue keeps running ready tasks back to back, without going back to the
+ * scheduler, until the budget is used up or the queue is empty.
+ *
+ * @param attr Indicates a pointer to the queue attribute.
+ * @param max_task_num Indicates the maximum number of tasks run in one go, 0 disables the budget.
+ * @param max_time_us Indicates the maximum time of one run in microseconds, 0 means no time limit.
+ */
+FFRT_C_API void ffrt_queue_attr_set_run_budget(ffrt_queue_attr_t* attr, uint32_t max_task_num, uint64_t max_time_us);
+
+/**
+ * @brief Obtains the maximum number of tasks run in one go by a serial queue.
+ *
+ * @param attr Indicates a pointer to the queue attribute.
+ * @return Returns the task number of the run budget.
+ */
+FFRT_C_API uint32_t ffrt_queue_attr_get_run_budget_task_num(const ffrt_queue_attr_t* attr);
+
+/**
+ * @brief Obtains the maximum time of one run of a serial queue.
+ *
+ * @param attr Indicates a pointer to the queue attribute.
+ * @return Returns the time of the run budget in microseconds.
+ */
+FFRT_C_API uint64_t ffrt_queue_attr_get_run_budget_time(const ffrt_queue_attr_t* attr);
+
 #endif
\ No newline at end of file
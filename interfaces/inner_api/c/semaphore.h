@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_INNER_API_C_SEMAPHORE_H
+#define FFRT_INNER_API_C_SEMAPHORE_H
+
+#include "c/type_def_ext.h"
+
+/**
+ * @brief Initializes a counting semaphore.
+ *
+ * Waiting on the semaphore suspends the calling task instead of its worker thread. Acquiring and releasing
+ * an available permit only touch an atomic counter.
+ *
+ * @param sem Indicates a pointer to the semaphore.
+ * @param value Indicates the initial number of permits.
+ * @return Returns <b>ffrt_success</b> if the semaphore is initialized;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_sem_init(ffrt_sem_t* sem, uint32_t value);
+
+/**
+ * @brief Releases permits to a semaphore, waking up as many waiters.
+ *
+ * @param sem Indicates a pointer to the semaphore.
+ * @param count Indicates the number of permits to release.
+ * @return Returns <b>ffrt_success</b> if the permits are released;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_sem_post(ffrt_sem_t* sem, uint32_t count);
+
+/**
+ * @brief Acquires a permit from a semaphore, waiting until one is available.
+ *
+ * @param sem Indicates a pointer to the semaphore.
+ * @return Returns <b>ffrt_success</b> if a permit is acquired;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_sem_wait(ffrt_sem_t* sem);
+
+/**
+ * @brief Attempts to acquire a permit from a semaphore without waiting.
+ *
+ * @param sem Indicates a pointer to the semaphore.
+ * @return Returns <b>ffrt_success</b> if a permit is acquired;
+           returns <b>ffrt_error_busy</b> if no permit is available;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_sem_trywait(ffrt_sem_t* sem);
+
+/**
+ * @brief Destroys a semaphore.
+ *
+ * @param sem Indicates a pointer to the semaphore.
+ * @return Returns <b>ffrt_success</b> if the semaphore is destroyed;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_sem_destroy(ffrt_sem_t* sem);
+
+#endif
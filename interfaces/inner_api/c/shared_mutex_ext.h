@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_INNER_API_C_SHARED_MUTEX_EXT_H
+#define FFRT_INNER_API_C_SHARED_MUTEX_EXT_H
+
+#include <stdbool.h>
+#include "c/type_def.h"
+
+/**
+ * @brief Initializes a rwlock attribute with the normal rwlock type.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @return Returns <b>ffrt_success</b> if the attribute is initialized;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_rwlockattr_init(ffrt_rwlockattr_t* attr);
+
+/**
+ * @brief Sets whether the rwlock is read-biased.
+ *
+ * A read-biased rwlock counts readers in per-thread slots, so that concurrent readers do not contend on a shared
+ * cacheline, while writers pay for blocking new readers and draining all slots.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @param read_biased Indicates whether the rwlock is read-biased.
+ * @return Returns <b>ffrt_success</b> if the attribute is set;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_rwlockattr_setreadbiased(ffrt_rwlockattr_t* attr, bool read_biased);
+
+/**
+ * @brief Obtains whether the rwlock is read-biased.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @param read_biased Indicates a pointer to the result.
+ * @return Returns <b>ffrt_success</b> if the attribute is obtained;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_rwlockattr_getreadbiased(const ffrt_rwlockattr_t* attr, bool* read_biased);
+
+/**
+ * @brief Destroys a rwlock attribute.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @return Returns <b>ffrt_success</b> if the attribute is destroyed;
+           returns <b>ffrt_error_inval</b> otherwise.
+ */
+FFRT_C_API int ffrt_rwlockattr_destroy(ffrt_rwlockattr_t* attr);
+
+#endif
@@ -62,6 +62,22 @@ FFRT_C_API int ffrt_set_cpu_worker_max_num(ffrt_qos_t qos, uint32_t num);
  */
 FFRT_C_API void ffrt_task_attr_set_notify_worker(ffrt_task_attr_t* attr, bool notify);
 
+/**
+ * @brief Sets the priority of a task within its QoS, only support for normal task.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param priority Indicates the priority, defined by {@link ffrt_task_priority_t}.
+ */
+FFRT_C_API void ffrt_task_attr_set_priority(ffrt_task_attr_t* attr, ffrt_task_priority_t priority);
+
+/**
+ * @brief Gets the priority of a task within its QoS.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return Returns the priority of the task attribute.
+ */
+FFRT_C_API ffrt_task_priority_t ffrt_task_attr_get_priority(const ffrt_task_attr_t* attr);
+
 /**
  * @brief Notifies a specified number of workers at a specified QoS level.
  *
@@ -103,8 +119,149 @@ FFRT_C_API int ffrt_enable_worker_escape(uint64_t one_stage_interval_ms, uint64_
  */
 FFRT_C_API void ffrt_disable_worker_escape(void);
 
+/**
+ * @brief Enables the worker pressure scaling function.
+ *
+ * Every interval, the cpu pressure stall information of the cgroup of the process (or of the system) and the
+ * runqueue length are sampled. While some runnable tasks stall on the cpus for at least the threshold share of the
+ * interval and there are more runnable tasks than cpus, the maximum number of running workers of each QoS is
+ * lowered step by step; it is raised back once the stall drops below half of the threshold.
+ *
+ * @param interval_ms Indicates the sampling interval, which cannot be smaller than 10ms.
+ * @param stall_threshold_pct Indicates the stall threshold in percent, in (0, 100].
+ * @return Returns 0 if the parameters are valid, the pressure stall information is available and the function is
+ *         enabled successfully; returns 1 otherwise.
+ */
+FFRT_C_API int ffrt_enable_worker_pressure_scaling(uint64_t interval_ms, uint32_t stall_threshold_pct);
+
+/**
+ * @brief Disables the worker pressure scaling function and restores the maximum number of running workers.
+ */
+FFRT_C_API void ffrt_disable_worker_pressure_scaling(void);
+
 /**
  * @brief Set the sched mode of the QoS.
  */
 FFRT_C_API void ffrt_set_sched_mode(ffrt_qos_t qos, ffrt_sched_mode mode);
+
+/**
+ * @brief Sets the policy ordering the ready tasks of the QoS.
+ *
+ * @param qos Indicates the QoS.
+ * @param policy Indicates the policy, defined by {@link ffrt_sched_policy}.
+ * @return Returns ffrt_success if the policy is set; returns ffrt_error_inval otherwise.
+ */
+FFRT_C_API int ffrt_set_sched_policy(ffrt_qos_t qos, ffrt_sched_policy policy);
+
+/**
+ * @brief Sets the deadline of a task, only support for normal task.
+ *
+ * The deadline is relative to the creation of the task. A task without a deadline inherits the one of its
+ * parent task, or, when submitted from a thread, the one of the interval begun or joined on that thread.
+ * Under ffrt_sched_policy_edf, ready tasks with a deadline are dispatched earliest deadline first.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param deadline_us Indicates the deadline, in microseconds. 0 means no deadline.
+ */
+FFRT_C_API void ffrt_task_attr_set_deadline(ffrt_task_attr_t* attr, uint64_t deadline_us);
+
+/**
+ * @brief Gets the deadline of a task attribute.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return Returns the deadline, in microseconds.
+ */
+FFRT_C_API uint64_t ffrt_task_attr_get_deadline(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Gets the number of tasks of the QoS that finished after their deadline.
+ *
+ * @param qos Indicates the QoS.
+ * @return Returns the number of deadline misses.
+ */
+FFRT_C_API uint64_t ffrt_get_deadline_miss_count(ffrt_qos_t qos);
+
+/**
+ * @brief Sets the cpus a task prefers to run on, only support for normal task.
+ *
+ * The hint is soft: a ready task is dispatched to a worker on one of the cpus when one asks for work soon,
+ * and to any worker otherwise. The hint is ignored under a custom sched policy and for tasks dispatched by
+ * deadline. The hit rate is reported by ffrt_dump with DUMP_AFFINITY_HINT_INFO.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param cpu_mask Indicates the cpus, bit n for cpu n. 0 means no hint.
+ */
+FFRT_C_API void ffrt_task_attr_set_affinity_hint(ffrt_task_attr_t* attr, uint64_t cpu_mask);
+
+/**
+ * @brief Gets the affinity hint of a task attribute.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return Returns the cpu mask.
+ */
+FFRT_C_API uint64_t ffrt_task_attr_get_affinity_hint(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Creates a task group.
+ *
+ * Tasks submitted to the group and all tasks they submit belong to the group until they are done.
+ *
+ * @return Returns a non-null task group handle if the group is created;
+           returns a null pointer otherwise.
+ */
+FFRT_C_API ffrt_task_group_t ffrt_task_group_create(void);
+
+/**
+ * @brief Destroys a task group handle. Tasks of the group still running keep the group alive.
+ *
+ * @param group Indicates a task group handle.
+ */
+FFRT_C_API void ffrt_task_group_destroy(ffrt_task_group_t group);
+
+/**
+ * @brief Submits a task to a task group, see ffrt_submit_base.
+ *
+ * @param group Indicates a task group handle.
+ * @param f Indicates a pointer to the task executor.
+ * @param in_deps Indicates a pointer to the input dependencies.
+ * @param out_deps Indicates a pointer to the output dependencies.
+ * @param attr Indicates a pointer to the task attribute.
+ */
+FFRT_C_API void ffrt_task_group_submit(ffrt_task_group_t group, ffrt_function_header_t* f,
+    const ffrt_deps_t* in_deps, const ffrt_deps_t* out_deps, const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Cancels a task group.
+ *
+ * Tasks of the group that have not started are dropped without running. Running tasks are not interrupted,
+ * they can poll ffrt_this_task_is_cancelled to stop early.
+ *
+ * @param group Indicates a task group handle.
+ */
+FFRT_C_API void ffrt_task_group_cancel(ffrt_task_group_t group);
+
+/**
+ * @brief Checks whether a task group is cancelled.
+ *
+ * @param group Indicates a task group handle.
+ * @return Returns true if the group is cancelled; returns false otherwise.
+ */
+FFRT_C_API bool ffrt_task_group_is_cancelled(ffrt_task_group_t group);
+
+/**
+ * @brief Waits until all tasks of a task group, including the ones they submitted, are done or dropped.
+ *
+ * @param group Indicates a task group handle.
+ * @return Returns ffrt_success if the wait succeeds;
+           returns ffrt_error if called from a task of the group;
+           returns ffrt_error_inval if the group is invalid.
+ */
+FFRT_C_API int ffrt_task_group_wait(ffrt_task_group_t group);
+
+/**
+ * @brief Checks whether the task group of the current task is cancelled.
+ *
+ * @return Returns true if the current task belongs to a cancelled task group; returns false otherwise.
+ */
+FFRT_C_API bool ffrt_this_task_is_cancelled(void);
 #endif
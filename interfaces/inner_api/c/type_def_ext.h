@@ -33,6 +33,18 @@
 
 typedef ffrt_qos_default_t ffrt_inner_qos_default_t;
 
+/**
+ * @brief Enumerates the priorities of tasks within one QoS.
+ *
+ * Tasks of a QoS are dispatched from the highest priority first, in submission order within a priority.
+ * A priority passed over too many times in a row gets a turn, so lower priorities are not starved.
+ */
+typedef enum {
+    ffrt_task_priority_high = 0,
+    ffrt_task_priority_normal,
+    ffrt_task_priority_low,
+} ffrt_task_priority_t;
+
 typedef enum {
     ffrt_stack_protect_weak,
     ffrt_stack_protect_strong
@@ -40,12 +52,27 @@ typedef enum {
 
 typedef enum {
     ffrt_thread_attr_storage_size = 64,
+    ffrt_sem_storage_size = 64,
+    ffrt_latch_storage_size = 64,
+    ffrt_barrier_storage_size = 64,
 } ffrt_inner_storage_size_t;
 
 typedef struct {
     uint32_t storage[(ffrt_thread_attr_storage_size + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
 } ffrt_thread_attr_t;
 
+typedef struct {
+    uint32_t storage[(ffrt_sem_storage_size + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
+} ffrt_sem_t;
+
+typedef struct {
+    uint32_t storage[(ffrt_latch_storage_size + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
+} ffrt_latch_t;
+
+typedef struct {
+    uint32_t storage[(ffrt_barrier_storage_size + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
+} ffrt_barrier_t;
+
 #define MAX_CPUMAP_LENGTH 100 // this is in c and code style
 typedef struct {
     int shares;
@@ -73,6 +100,8 @@ typedef void* ffrt_sys_event_handle_t;
 
 typedef void* ffrt_config_t;
 
+typedef void* ffrt_task_group_t;
+
 typedef enum {
     ffrt_coroutine_stackless,
     ffrt_coroutine_with_stack,
@@ -103,6 +132,16 @@ typedef enum {
     ffrt_sched_energy_saving_mode,
 } ffrt_sched_mode;
 
+/**
+ * @brief Enumerates the policies ordering the ready tasks of a QoS.
+ */
+typedef enum {
+    /** Submission order within each task priority. */
+    ffrt_sched_policy_fifo = 0,
+    /** Tasks with a deadline first, earliest deadline first, then the others as with ffrt_sched_policy_fifo. */
+    ffrt_sched_policy_edf,
+} ffrt_sched_policy;
+
 #ifdef __cplusplus
 namespace ffrt {
 typedef enum qos_default qos_inner_default;
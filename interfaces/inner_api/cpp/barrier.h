@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_BARRIER_H
+#define FFRT_API_CPP_BARRIER_H
+#include <cstddef>
+#include <cstdint>
+#include "c/barrier.h"
+
+namespace ffrt {
+/**
+ * @brief Single-use countdown with the interface of std::latch.
+ *
+ * When called inside an FFRT task, wait suspends the task instead of the worker thread.
+ */
+class latch : public ffrt_latch_t {
+public:
+    explicit latch(std::ptrdiff_t expected)
+    {
+        ffrt_latch_init(this, static_cast<uint32_t>(expected));
+    }
+
+    ~latch()
+    {
+        ffrt_latch_destroy(this);
+    }
+
+    latch(const latch&) = delete;
+    void operator=(const latch&) = delete;
+
+    inline void count_down(std::ptrdiff_t n = 1)
+    {
+        ffrt_latch_count_down(this, static_cast<uint32_t>(n));
+    }
+
+    inline bool try_wait() const noexcept
+    {
+        return ffrt_latch_try_wait(const_cast<latch*>(this)) == ffrt_success;
+    }
+
+    inline void wait() const
+    {
+        ffrt_latch_wait(const_cast<latch*>(this));
+    }
+
+    inline void arrive_and_wait(std::ptrdiff_t n = 1)
+    {
+        ffrt_latch_arrive_and_wait(this, static_cast<uint32_t>(n));
+    }
+};
+
+/**
+ * @brief Reusable phase barrier with the blocking part of the interface of std::barrier.
+ *
+ * Completion functions and arrival tokens are not supported. When called inside an FFRT task,
+ * arrive_and_wait suspends the task instead of the worker thread.
+ */
+class barrier : public ffrt_barrier_t {
+public:
+    explicit barrier(std::ptrdiff_t expected)
+    {
+        ffrt_barrier_init(this, static_cast<uint32_t>(expected));
+    }
+
+    ~barrier()
+    {
+        ffrt_barrier_destroy(this);
+    }
+
+    barrier(const barrier&) = delete;
+    void operator=(const barrier&) = delete;
+
+    inline void arrive_and_wait()
+    {
+        ffrt_barrier_arrive_and_wait(this);
+    }
+
+    inline void arrive_and_drop()
+    {
+        ffrt_barrier_arrive_and_drop(this);
+    }
+};
+} // namespace ffrt
+#endif // FFRT_API_CPP_BARRIER_H
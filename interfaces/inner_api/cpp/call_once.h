@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_CALL_ONCE_H
+#define FFRT_API_CPP_CALL_ONCE_H
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include "cpp/semaphore.h"
+
+namespace ffrt {
+/**
+ * @brief Flag for ffrt::call_once.
+ *
+ * Unlike std::once_flag it is not constexpr constructible, since it owns an ffrt semaphore.
+ */
+class once_flag {
+    template <typename Callable, typename... Args>
+    friend void call_once(once_flag& flag, Callable&& f, Args&&... args);
+
+public:
+    once_flag() = default;
+    once_flag(const once_flag&) = delete;
+    once_flag& operator=(const once_flag&) = delete;
+
+private:
+    static constexpr uint32_t INIT = 0;
+    static constexpr uint32_t RUNNING = 1;
+    static constexpr uint32_t DONE = 2;
+
+    template <typename Callable, typename... Args>
+    void call_slow(Callable&& f, Args&&... args)
+    {
+        uint32_t expected = INIT;
+        if (m_state.compare_exchange_strong(expected, RUNNING, std::memory_order_acquire,
+            std::memory_order_acquire)) {
+            std::invoke(std::forward<Callable>(f), std::forward<Args>(args)...);
+            // pairs with the waiter side: either the waiter sees DONE, or it is counted and gets a permit
+            m_state.store(DONE, std::memory_order_seq_cst);
+            uint32_t waiters = m_waiters.load(std::memory_order_seq_cst);
+            if (waiters > 0) {
+                m_sem.release(waiters);
+            }
+            return;
+        }
+        if (expected == DONE) {
+            return;
+        }
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        // a waiter both counted and finding DONE leaves a spare permit behind, which is harmless once done
+        if (m_state.load(std::memory_order_seq_cst) != DONE) {
+            m_sem.acquire();
+        }
+    }
+
+    std::atomic<uint32_t> m_state {INIT};
+    std::atomic<uint32_t> m_waiters {0};
+    counting_semaphore<> m_sem {0};
+};
+
+/**
+ * @brief Calls f exactly once for the flag, even when called concurrently.
+ *
+ * Once the call has completed, call_once costs a single acquire load. Callers arriving while the call is
+ * running wait for it to complete, suspending the task instead of the worker thread. f must not throw.
+ */
+template <typename Callable, typename... Args>
+inline void call_once(once_flag& flag, Callable&& f, Args&&... args)
+{
+    if (flag.m_state.load(std::memory_order_acquire) == once_flag::DONE) {
+        return;
+    }
+    flag.call_slow(std::forward<Callable>(f), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Value constructed by a factory on first access, using ffrt::call_once.
+ */
+template <typename T, typename F = std::function<T()>>
+class lazy {
+public:
+    explicit lazy(F factory) : m_factory(std::move(factory)) {}
+    lazy(const lazy&) = delete;
+    lazy& operator=(const lazy&) = delete;
+
+    T& get()
+    {
+        call_once(m_flag, [this] { m_value.emplace(m_factory()); });
+        return *m_value;
+    }
+
+    T& operator*()
+    {
+        return get();
+    }
+
+    T* operator->()
+    {
+        return &get();
+    }
+
+private:
+    once_flag m_flag;
+    F m_factory;
+    std::optional<T> m_value;
+};
+} // namespace ffrt
+#endif // FFRT_API_CPP_CALL_ONCE_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_CHANNEL_H
+#define FFRT_API_CPP_CHANNEL_H
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "cpp/condition_variable.h"
+#include "cpp/mutex.h"
+#include "cpp/queue.h"
+
+namespace ffrt {
+namespace detail {
+template <typename T>
+struct channel_state {
+    explicit channel_state(size_t capacity) : m_buf(capacity > 0 ? capacity : 1)
+    {
+    }
+
+    bool full() const noexcept
+    {
+        return m_size == m_buf.size();
+    }
+
+    void push(T&& value)
+    {
+        m_buf[(m_head + m_size) % m_buf.size()].emplace(std::move(value));
+        ++m_size;
+    }
+
+    T pop()
+    {
+        T value = std::move(*m_buf[m_head]);
+        m_buf[m_head].reset();
+        m_head = (m_head + 1) % m_buf.size();
+        --m_size;
+        return value;
+    }
+
+    // runs on the bound queue, one task per burst of items instead of one task per item
+    static void drain(const std::shared_ptr<channel_state>& state)
+    {
+        std::unique_lock<mutex> lk(state->m_mtx);
+        while (state->m_size > 0) {
+            T value = state->pop();
+            state->m_notFull.notify_one();
+            lk.unlock();
+            state->m_consumer(std::move(value));
+            lk.lock();
+        }
+        state->m_drainPending = false;
+    }
+
+    mutex m_mtx;
+    condition_variable m_notFull;
+    condition_variable m_notEmpty;
+    std::vector<std::optional<T>> m_buf;
+    size_t m_head {0};
+    size_t m_size {0};
+    bool m_closed {false};
+
+    queue* m_queue {nullptr};
+    std::function<void(T&&)> m_consumer;
+    bool m_drainPending {false};
+};
+} // namespace detail
+
+/**
+ * @brief Bounded channel passing items between tasks or queues through a ring buffer.
+ *
+ * Copies of a channel share the same buffer. When called inside an FFRT task, blocking send/recv
+ * suspend the task instead of the worker thread.
+ */
+template <typename T>
+class channel {
+public:
+    explicit channel(size_t capacity) : m_state(std::make_shared<detail::channel_state<T>>(capacity))
+    {
+    }
+
+    /**
+     * @brief Moves an item into the channel, waiting while the channel is full.
+     *
+     * @return Returns true if the item is sent; returns false if the channel is closed.
+     */
+    bool send(T value)
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        m_state->m_notFull.wait(lk, [this] { return !m_state->full() || m_state->m_closed; });
+        if (m_state->m_closed) {
+            return false;
+        }
+        return push_locked(lk, std::move(value));
+    }
+
+    /**
+     * @brief Moves an item into the channel without waiting.
+     *
+     * @return Returns true if the item is sent; returns false if the channel is full or closed.
+     */
+    bool try_send(T value)
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        if (m_state->full() || m_state->m_closed) {
+            return false;
+        }
+        return push_locked(lk, std::move(value));
+    }
+
+    /**
+     * @brief Takes an item from the channel, waiting while the channel is empty.
+     *
+     * @return Returns the item; returns std::nullopt once the channel is closed and drained.
+     */
+    std::optional<T> recv()
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        m_state->m_notEmpty.wait(lk, [this] { return m_state->m_size > 0 || m_state->m_closed; });
+        if (m_state->m_size == 0) {
+            return std::nullopt;
+        }
+        T value = m_state->pop();
+        m_state->m_notFull.notify_one();
+        return value;
+    }
+
+    /**
+     * @brief Takes an item from the channel without waiting.
+     *
+     * @return Returns the item; returns std::nullopt if the channel is empty.
+     */
+    std::optional<T> try_recv()
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        if (m_state->m_size == 0) {
+            return std::nullopt;
+        }
+        T value = m_state->pop();
+        m_state->m_notFull.notify_one();
+        return value;
+    }
+
+    /**
+     * @brief Makes a queue the consumer of the channel.
+     *
+     * Every item sent afterwards is passed to the consumer on the queue, and recv must not be used.
+     * The queue must outlive the items sent to the channel.
+     *
+     * @return Returns true if the channel is bound; returns false if it is already bound.
+     */
+    bool bind(queue& q, std::function<void(T&&)> consumer)
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        if (m_state->m_queue != nullptr || !consumer) {
+            return false;
+        }
+        m_state->m_queue = &q;
+        m_state->m_consumer = std::move(consumer);
+        schedule_drain_locked(lk);
+        return true;
+    }
+
+    /**
+     * @brief Closes the channel, waking up all waiting senders and receivers.
+     *
+     * Items already in the channel can still be received.
+     */
+    void close() noexcept
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        m_state->m_closed = true;
+        m_state->m_notFull.notify_all();
+        m_state->m_notEmpty.notify_all();
+    }
+
+    size_t size() const noexcept
+    {
+        std::unique_lock<mutex> lk(m_state->m_mtx);
+        return m_state->m_size;
+    }
+
+    size_t capacity() const noexcept
+    {
+        return m_state->m_buf.size();
+    }
+
+private:
+    bool push_locked(std::unique_lock<mutex>& lk, T&& value)
+    {
+        m_state->push(std::move(value));
+        if (m_state->m_queue == nullptr) {
+            m_state->m_notEmpty.notify_one();
+            return true;
+        }
+        schedule_drain_locked(lk);
+        return true;
+    }
+
+    void schedule_drain_locked(std::unique_lock<mutex>& lk)
+    {
+        if (m_state->m_drainPending || m_state->m_size == 0) {
+            return;
+        }
+        m_state->m_drainPending = true;
+        queue* q = m_state->m_queue;
+        lk.unlock();
+        std::shared_ptr<detail::channel_state<T>> state = m_state;
+        q->submit([state] { detail::channel_state<T>::drain(state); });
+    }
+
+    std::shared_ptr<detail::channel_state<T>> m_state;
+};
+} // namespace ffrt
+#endif // FFRT_API_CPP_CHANNEL_H
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_FAIR_MUTEX_H
+#define FFRT_API_CPP_FAIR_MUTEX_H
+#include <chrono>
+#include "c/mutex_ext.h"
+#include "cpp/mutex.h"
+
+namespace ffrt {
+/**
+ * @brief Mutex in fair mode, see ffrt_mutexattr_setfair.
+ *
+ * Unlike ffrt::mutex, every call goes through the library, as the inline lock word handling of ffrt::mutex would
+ * bypass the handover to the longest waiter.
+ */
+class fair_mutex : public ffrt_mutex_t {
+public:
+    fair_mutex()
+    {
+        ffrt_mutexattr_t attr;
+        ffrt_mutexattr_init(&attr);
+        ffrt_mutexattr_setfair(&attr, true);
+        ffrt_mutex_init(this, &attr);
+        ffrt_mutexattr_destroy(&attr);
+    }
+
+    ~fair_mutex()
+    {
+        ffrt_mutex_destroy(this);
+    }
+
+    fair_mutex(const fair_mutex&) = delete;
+    void operator=(const fair_mutex&) = delete;
+
+    inline bool try_lock()
+    {
+        return ffrt_mutex_trylock(this) == ffrt_success;
+    }
+
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout_duration)
+    {
+        timespec ts = detail::to_deadline(timeout_duration);
+        return ffrt_mutex_timedlock(this, &ts) == ffrt_success;
+    }
+
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& timeout_time)
+    {
+        return try_lock_for(timeout_time - Clock::now());
+    }
+
+    inline void lock()
+    {
+        ffrt_mutex_lock(this);
+    }
+
+    inline void unlock()
+    {
+        ffrt_mutex_unlock(this);
+    }
+};
+} // namespace ffrt
+#endif // FFRT_API_CPP_FAIR_MUTEX_H
@@ -14,10 +14,16 @@
  */
 #ifndef FFRT_API_CPP_FUTURE_H
 #define FFRT_API_CPP_FUTURE_H
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <chrono>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "cpp/condition_variable.h"
+#include "cpp/semaphore.h"
+#include "cpp/task.h"
 #include "thread.h"
 
 namespace ffrt {
@@ -30,73 +36,202 @@ protected:
 };
 enum class future_status { ready, timeout, deferred };
 
+template <typename R>
+class future;
+
 namespace detail {
+// callback attached to a shared state, the state never touches a node after calling run or discard on it
+struct continuation {
+    virtual ~continuation() = default;
+    // called once when the state becomes ready
+    virtual void run() noexcept = 0;
+    // called instead of run when the state is destroyed without a value
+    virtual void discard() noexcept = 0;
+    continuation* next = nullptr;
+};
+
+/*
+ * The state word is either the head of a lock-free stack of continuations, or the ready tag once the value is
+ * published. Getting a value that is already set costs one atomic load, and only a waiter finding the value
+ * missing suspends, on a semaphore owned by its own stack frame.
+ */
 template <typename Derived>
 struct shared_state_base : private non_copyable {
+    ~shared_state_base()
+    {
+        continuation* head = m_head.load(std::memory_order_acquire);
+        if (head != ready_tag()) {
+            while (head != nullptr) {
+                continuation* next = head->next;
+                head->discard();
+                head = next;
+            }
+        }
+        delete m_timed.load(std::memory_order_acquire);
+    }
+
+    bool has_value() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) == ready_tag();
+    }
+
     void wait() const noexcept
     {
-        std::unique_lock lk(this->m_mtx);
-        wait_(lk);
+        if (has_value()) {
+            return;
+        }
+        struct waiter : continuation {
+            binary_semaphore sem {0};
+            void run() noexcept override
+            {
+                sem.release();
+            }
+            // the waiter keeps the state alive, so it is never discarded
+            void discard() noexcept override {}
+        } w;
+        if (attach(&w)) {
+            w.sem.acquire();
+        }
     }
 
     template <typename Rep, typename Period>
     future_status wait_for(const std::chrono::duration<Rep, Period>& waitTime) const noexcept
     {
-        std::unique_lock<mutex> lk(m_mtx);
-        return m_cv.wait_for(lk, waitTime, [this] { return get_derived().has_value(); }) ? future_status::ready :
-            future_status::timeout;
+        return timed_wait([&waitTime](condition_variable& cv, std::unique_lock<mutex>& lk, const bool& done) {
+            return cv.wait_for(lk, waitTime, [&done] { return done; });
+        });
     }
 
     template <typename Clock, typename Duration>
     future_status wait_until(const std::chrono::time_point<Clock, Duration>& tp) const noexcept
     {
-        std::unique_lock<mutex> lk(m_mtx);
-        return m_cv.wait_until(lk, tp, [this] { return get_derived().has_value(); }) ? future_status::ready :
-            future_status::timeout;
+        return timed_wait([&tp](condition_variable& cv, std::unique_lock<mutex>& lk, const bool& done) {
+            return cv.wait_until(lk, tp, [&done] { return done; });
+        });
+    }
+
+    // returns false if the state is already ready, in which case the caller runs the continuation itself
+    bool attach(continuation* c) const noexcept
+    {
+        continuation* head = m_head.load(std::memory_order_acquire);
+        do {
+            if (head == ready_tag()) {
+                return false;
+            }
+            c->next = head;
+        } while (!m_head.compare_exchange_weak(head, c, std::memory_order_release, std::memory_order_acquire));
+        return true;
     }
 
 protected:
-    void wait_(std::unique_lock<mutex>& lk) const noexcept
+    // only the first setter gets to write the value
+    bool try_satisfy() noexcept
     {
-        m_cv.wait(lk, [this] { return get_derived().has_value(); });
+        return !m_satisfied.exchange(true, std::memory_order_relaxed);
     }
 
-    mutable mutex m_mtx;
-    mutable condition_variable m_cv;
+    void publish() noexcept
+    {
+        continuation* head = m_head.exchange(ready_tag(), std::memory_order_acq_rel);
+        // the stack is LIFO, reverse it so that continuations run in the order they were attached
+        continuation* list = nullptr;
+        while (head != nullptr) {
+            continuation* next = head->next;
+            head->next = list;
+            list = head;
+            head = next;
+        }
+        while (list != nullptr) {
+            continuation* next = list->next;
+            list->run();
+            list = next;
+        }
+    }
 
 private:
-    const Derived& get_derived() const
+    static continuation* ready_tag() noexcept
     {
-        return *static_cast<const Derived*>(this);
+        return reinterpret_cast<continuation*>(static_cast<uintptr_t>(1));
+    }
+
+    // shared by all timed waits on the state and owned by it, so a waiter giving up leaves nothing behind
+    struct timed_waiter : continuation {
+        void run() noexcept override
+        {
+            {
+                std::unique_lock<mutex> lk(mtx);
+                done = true;
+            }
+            cv.notify_all();
+        }
+        void discard() noexcept override {}
+        mutex mtx;
+        condition_variable cv;
+        bool done {false};
+    };
+
+    // the first timed wait attaches the waiter, later ones reuse it
+    timed_waiter* get_timed_waiter() const noexcept
+    {
+        timed_waiter* node = m_timed.load(std::memory_order_acquire);
+        if (node != nullptr) {
+            return node;
+        }
+        auto created = new timed_waiter();
+        if (!m_timed.compare_exchange_strong(node, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            delete created;
+            return node;
+        }
+        if (!attach(created)) {
+            created->run();
+        }
+        return created;
+    }
+
+    template <typename WaitFn>
+    future_status timed_wait(WaitFn&& waitFn) const noexcept
+    {
+        if (has_value()) {
+            return future_status::ready;
+        }
+        timed_waiter* node = get_timed_waiter();
+        std::unique_lock<mutex> lk(node->mtx);
+        return waitFn(node->cv, lk, node->done) ? future_status::ready : future_status::timeout;
     }
+
+    mutable std::atomic<continuation*> m_head {nullptr};
+    mutable std::atomic<timed_waiter*> m_timed {nullptr};
+    std::atomic<bool> m_satisfied {false};
 };
 
 template <typename R>
 struct shared_state : public shared_state_base<shared_state<R>> {
     void set_value(const R& value) noexcept
     {
-        std::unique_lock<mutex> lk(this->m_mtx);
-        m_res.emplace(value);
-        this->m_cv.notify_all();
+        if (this->try_satisfy()) {
+            m_res.emplace(value);
+            this->publish();
+        }
     }
 
     void set_value(R&& value) noexcept
     {
-        std::unique_lock<mutex> lk(this->m_mtx);
-        m_res.emplace(std::move(value));
-        this->m_cv.notify_all();
+        if (this->try_satisfy()) {
+            m_res.emplace(std::move(value));
+            this->publish();
+        }
     }
 
     R& get() noexcept
     {
-        std::unique_lock lk(this->m_mtx);
-        this->wait_(lk);
+        this->wait();
         return m_res.value();
     }
 
-    bool has_value() const noexcept
+    // only valid once the state is ready
+    R& value() noexcept
     {
-        return m_res.has_value();
+        return *m_res;
     }
 
 private:
@@ -107,24 +242,88 @@ template <>
 struct shared_state<void> : public shared_state_base<shared_state<void>> {
     void set_value() noexcept
     {
-        std::unique_lock<mutex> lk(this->m_mtx);
-        m_hasValue = true;
-        this->m_cv.notify_all();
+        if (this->try_satisfy()) {
+            this->publish();
+        }
     }
 
     void get() noexcept
     {
-        std::unique_lock lk(this->m_mtx);
-        this->wait_(lk);
+        this->wait();
     }
+};
 
-    bool has_value() const noexcept
+// runs a callable inline on the thread making the state ready
+template <typename R, typename Fn>
+struct callback_node : continuation {
+    callback_node(shared_state<R>* src, Fn&& fn) : m_src(src), m_fn(std::move(fn)) {}
+    void run() noexcept override
+    {
+        m_fn(*m_src);
+        delete this;
+    }
+    void discard() noexcept override
+    {
+        delete this;
+    }
+    shared_state<R>* m_src;
+    Fn m_fn;
+};
+
+template <typename R, typename Fn>
+void on_ready(const std::shared_ptr<shared_state<R>>& src, Fn&& fn)
+{
+    auto node = new callback_node<R, std::decay_t<Fn>>(src.get(), std::forward<Fn>(fn));
+    if (!src->attach(node)) {
+        node->run();
+    }
+}
+
+template <typename F, typename R>
+struct then_result {
+    using type = std::invoke_result_t<F, R>;
+};
+
+template <typename F>
+struct then_result<F, void> {
+    using type = std::invoke_result_t<F>;
+};
+
+// moves the value out of the source state and runs the continuation as an ffrt task
+template <typename R, typename F, typename U>
+struct then_job {
+    then_job(F&& f, const std::shared_ptr<shared_state<U>>& dst) : m_fn(std::move(f)), m_dst(dst) {}
+
+    void operator()() noexcept
     {
-        return m_hasValue;
+        if constexpr (std::is_void_v<U>) {
+            invoke();
+            m_dst->set_value();
+        } else {
+            m_dst->set_value(invoke());
+        }
     }
 
-private:
-    bool m_hasValue {false};
+    U invoke()
+    {
+        if constexpr (std::is_void_v<R>) {
+            return m_fn();
+        } else {
+            return m_fn(std::move(*m_arg));
+        }
+    }
+
+    F m_fn;
+    std::shared_ptr<shared_state<U>> m_dst;
+    std::optional<std::conditional_t<std::is_void_v<R>, char, R>> m_arg;
+};
+
+struct future_access {
+    template <typename R>
+    static const std::shared_ptr<shared_state<R>>& state(const future<R>& fut) noexcept
+    {
+        return fut.m_state;
+    }
 };
 }; // namespace detail
 
@@ -136,6 +335,8 @@ class future : private non_copyable {
     template <typename>
     friend struct packaged_task;
 
+    friend struct detail::future_access;
+
 public:
     explicit future(const std::shared_ptr<detail::shared_state<R>>& state) noexcept : m_state(state)
     {
@@ -193,6 +394,34 @@ public:
         std::swap(m_state, rhs.m_state);
     }
 
+    /**
+     * @brief Attaches a continuation consuming the value, which runs as an ffrt task once the value is set.
+     *
+     * The future becomes invalid. The continuation is called with the value, or without argument for
+     * future<void>, and its result is delivered through the returned future.
+     */
+    template <typename F>
+    future<typename detail::then_result<std::decay_t<F>, R>::type> then(F&& f,
+        qos qos_ = static_cast<int>(qos_default))
+    {
+        using U = typename detail::then_result<std::decay_t<F>, R>::type;
+        using job_t = detail::then_job<R, std::decay_t<F>, U>;
+        auto dst = std::make_shared<detail::shared_state<U>>();
+        auto job = std::make_unique<job_t>(std::decay_t<F>(std::forward<F>(f)), dst);
+        auto src = std::move(m_state);
+        detail::on_ready(src, [job = std::move(job), qos_](detail::shared_state<R>& state) mutable {
+            if constexpr (!std::is_void_v<R>) {
+                job->m_arg.emplace(std::move(state.value()));
+            }
+            job_t* p = job.release();
+            ffrt::submit([p] {
+                (*p)();
+                delete p;
+            }, task_attr().qos(qos_));
+        });
+        return future<U> {dst};
+    }
+
 private:
     std::shared_ptr<detail::shared_state<R>> m_state;
 };
@@ -344,6 +573,102 @@ private:
     std::shared_ptr<detail::shared_state<R>> m_state;
 };
 
+/**
+ * @brief Returns a future that becomes ready once all the given futures are ready, without blocking any task.
+ *
+ * The given futures become invalid. For non-void values, the results are collected in the input order.
+ */
+template <typename R>
+future<std::conditional_t<std::is_void_v<R>, void, std::vector<R>>> when_all(std::vector<future<R>> futures)
+{
+    using U = std::conditional_t<std::is_void_v<R>, void, std::vector<R>>;
+    struct all_state {
+        std::atomic<size_t> remaining;
+        std::vector<std::optional<std::conditional_t<std::is_void_v<R>, char, R>>> results;
+        std::shared_ptr<detail::shared_state<U>> dst;
+
+        void complete()
+        {
+            if constexpr (std::is_void_v<R>) {
+                dst->set_value();
+            } else {
+                U values;
+                values.reserve(results.size());
+                for (auto& res : results) {
+                    values.push_back(std::move(*res));
+                }
+                dst->set_value(std::move(values));
+            }
+        }
+    };
+
+    auto agg = std::make_shared<all_state>();
+    agg->dst = std::make_shared<detail::shared_state<U>>();
+    agg->remaining.store(futures.size(), std::memory_order_relaxed);
+    if constexpr (!std::is_void_v<R>) {
+        agg->results.resize(futures.size());
+    }
+    future<U> ret {agg->dst};
+    if (futures.empty()) {
+        agg->complete();
+        return ret;
+    }
+    for (size_t i = 0; i < futures.size(); i++) {
+        auto src = detail::future_access::state(futures[i]);
+        futures[i] = future<R> {};
+        detail::on_ready(src, [agg, i](detail::shared_state<R>& state) {
+            if constexpr (!std::is_void_v<R>) {
+                agg->results[i].emplace(std::move(state.value()));
+            } else {
+                (void)i;
+            }
+            if (agg->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                agg->complete();
+            }
+        });
+    }
+    return ret;
+}
+
+/**
+ * @brief Returns a future that becomes ready once any of the given futures is ready, without blocking any task.
+ *
+ * The given futures become invalid. The result holds the index of the first ready future, along with its value
+ * for non-void futures. An invalid future is returned if no future is given.
+ */
+template <typename R>
+future<std::conditional_t<std::is_void_v<R>, size_t, std::pair<size_t, R>>> when_any(
+    std::vector<future<R>> futures)
+{
+    using U = std::conditional_t<std::is_void_v<R>, size_t, std::pair<size_t, R>>;
+    if (futures.empty()) {
+        return future<U> {};
+    }
+    struct any_state {
+        std::atomic<bool> done {false};
+        std::shared_ptr<detail::shared_state<U>> dst;
+    };
+
+    auto agg = std::make_shared<any_state>();
+    agg->dst = std::make_shared<detail::shared_state<U>>();
+    future<U> ret {agg->dst};
+    for (size_t i = 0; i < futures.size(); i++) {
+        auto src = detail::future_access::state(futures[i]);
+        futures[i] = future<R> {};
+        detail::on_ready(src, [agg, i](detail::shared_state<R>& state) {
+            if (agg->done.exchange(true, std::memory_order_relaxed)) {
+                return;
+            }
+            if constexpr (std::is_void_v<R>) {
+                agg->dst->set_value(i);
+            } else {
+                agg->dst->set_value(std::make_pair(i, std::move(state.value())));
+            }
+        });
+    }
+    return ret;
+}
+
 template <typename F, typename... Args>
 future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> async(F&& f, Args&& ... args)
 {
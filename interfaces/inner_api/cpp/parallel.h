@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_PARALLEL_H
+#define FFRT_API_CPP_PARALLEL_H
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "cpp/condition_variable.h"
+#include "cpp/mutex.h"
+#include "cpp/task.h"
+
+namespace ffrt {
+namespace detail {
+struct parallel_void {};
+
+/*
+ * Lazy binary splitting: a participant walks its range grain by grain and only hands the upper half of what is
+ * left to a new task when every task handed out so far has been picked up by a worker, i.e. when some worker
+ * turned out to be idle. Halves nobody picked up are taken back and run by the participant that split them off.
+ */
+template <typename Index, typename Result, typename Body>
+class parallel_loop : public std::enable_shared_from_this<parallel_loop<Index, Result, Body>> {
+public:
+    struct range {
+        range(Index b, Index e, const Result& identity) : begin(b), end(e), result(identity) {}
+
+        Index begin;
+        Index end;
+        Result result;
+        std::atomic<bool> claimed {false};
+    };
+
+    parallel_loop(Body& body, Index grain, const Result& identity, qos qos_)
+        : m_body(body), m_grain(grain > 0 ? grain : 1), m_identity(identity), m_qos(qos_)
+    {
+    }
+
+    void run(range& r)
+    {
+        std::vector<std::shared_ptr<range>> spawned;
+        Index b = r.begin;
+        Index e = r.end;
+        while (b < e) {
+            if (e - b > m_grain && m_unclaimed.load(std::memory_order_relaxed) == 0) {
+                Index mid = b + (e - b) / 2;
+                spawned.push_back(spawn(mid, e));
+                e = mid;
+                continue;
+            }
+            Index next = e - b > m_grain ? b + m_grain : e;
+            r.result = m_body(b, next, std::move(r.result));
+            b = next;
+        }
+        // most recent first, it is the one right after the part just finished
+        for (auto it = spawned.rbegin(); it != spawned.rend(); ++it) {
+            if (claim(**it)) {
+                run(**it);
+                finish();
+            }
+        }
+    }
+
+    // runs [begin, end) on the caller, then combines the results of all parts in range order
+    template <typename Reduction>
+    Result invoke(Index begin, Index end, Reduction& reduction)
+    {
+        range root(begin, end, m_identity);
+        run(root);
+        if (m_work.load(std::memory_order_acquire) != 0) {
+            std::unique_lock<mutex> lk(m_mtx);
+            m_cv.wait(lk, [this] { return m_work.load(std::memory_order_acquire) == 0; });
+        }
+        Result acc = std::move(root.result);
+        std::sort(m_ranges.begin(), m_ranges.end(),
+            [](const std::shared_ptr<range>& l, const std::shared_ptr<range>& r) { return l->begin < r->begin; });
+        for (auto& r : m_ranges) {
+            acc = reduction(std::move(acc), std::move(r->result));
+        }
+        return acc;
+    }
+
+private:
+    std::shared_ptr<range> spawn(Index b, Index e)
+    {
+        auto r = std::make_shared<range>(b, e, m_identity);
+        if (!std::is_same<Result, parallel_void>::value) {
+            std::lock_guard<mutex> lk(m_mtx);
+            m_ranges.push_back(r);
+        }
+        m_unclaimed.fetch_add(1, std::memory_order_relaxed);
+        m_work.fetch_add(1, std::memory_order_relaxed);
+        auto self = this->shared_from_this();
+        submit([self, r] {
+            if (self->claim(*r)) {
+                self->run(*r);
+                self->finish();
+            }
+        }, task_attr().qos(m_qos));
+        return r;
+    }
+
+    bool claim(range& r)
+    {
+        if (r.claimed.exchange(true, std::memory_order_acquire)) {
+            return false;
+        }
+        m_unclaimed.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void finish()
+    {
+        if (m_work.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<mutex> lk(m_mtx);
+            m_cv.notify_all();
+        }
+    }
+
+    Body& m_body;
+    Index m_grain;
+    Result m_identity;
+    qos m_qos;
+    std::atomic<uint32_t> m_unclaimed {0};
+    std::atomic<uint32_t> m_work {0};
+    mutex m_mtx;
+    condition_variable m_cv;
+    std::vector<std::shared_ptr<range>> m_ranges;
+};
+} // namespace detail
+
+/**
+ * @brief Calls fn(i) for every i in [begin, end) in parallel, returning once all calls are done.
+ *
+ * The range is split on demand: new tasks are only created while workers are idle to take them, so a loop
+ * on a busy system runs mostly on the calling thread or task with no task overhead. Each split off part
+ * is run grain indexes at a time. Can be called from threads and from tasks.
+ *
+ * @param begin Indicates the first index.
+ * @param end Indicates the index past the last one.
+ * @param fn Indicates the function called for each index; it must not throw.
+ * @param grain Indicates the smallest number of indexes handed to a task; it takes the type of the range,
+ * so a plain literal works for any index type.
+ * @param qos_ Indicates the QoS of the tasks created.
+ */
+template <typename Index, typename Fn>
+inline void parallel_for(Index begin, Index end, Fn&& fn, typename std::common_type<Index>::type grain = 1,
+    qos qos_ = qos_inherit)
+{
+    static_assert(std::is_integral<Index>::value, "parallel_for needs an integral index");
+    if (begin >= end) {
+        return;
+    }
+    auto body = [&fn](Index b, Index e, detail::parallel_void&& v) {
+        for (Index i = b; i < e; ++i) {
+            fn(i);
+        }
+        return v;
+    };
+    auto none = [](detail::parallel_void&& l, detail::parallel_void&&) { return l; };
+    auto loop = std::make_shared<detail::parallel_loop<Index, detail::parallel_void, decltype(body)>>(
+        body, grain, detail::parallel_void {}, qos_);
+    loop->invoke(begin, end, none);
+}
+
+/**
+ * @brief Reduces [begin, end) in parallel, with ranges split on demand as in ffrt::parallel_for.
+ *
+ * Every part is folded by body(b, e, acc), which returns acc combined with the indexes of [b, e), starting
+ * from identity. The results of the parts are then combined in index order by reduction(left, right), so
+ * reduction needs to be associative but not commutative.
+ *
+ * @param begin Indicates the first index.
+ * @param end Indicates the index past the last one.
+ * @param identity Indicates the identity of reduction.
+ * @param body Indicates the function folding a range into an accumulator; it must not throw.
+ * @param reduction Indicates the function combining two partial results; it must not throw.
+ * @param grain Indicates the smallest number of indexes handed to a task.
+ * @param qos_ Indicates the QoS of the tasks created.
+ * @return Returns the reduction of the whole range.
+ */
+template <typename Index, typename T, typename Body, typename Reduction>
+inline T parallel_reduce(Index begin, Index end, const T& identity, Body&& body, Reduction&& reduction,
+    typename std::common_type<Index>::type grain = 1, qos qos_ = qos_inherit)
+{
+    static_assert(std::is_integral<Index>::value, "parallel_reduce needs an integral index");
+    if (begin >= end) {
+        return identity;
+    }
+    auto fold = [&body](Index b, Index e, T&& acc) -> T { return body(b, e, std::move(acc)); };
+    auto loop = std::make_shared<detail::parallel_loop<Index, T, decltype(fold)>>(fold, grain, identity, qos_);
+    return loop->invoke(begin, end, reduction);
+}
+} // namespace ffrt
+#endif // FFRT_API_CPP_PARALLEL_H
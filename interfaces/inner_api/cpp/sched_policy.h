@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_SCHED_POLICY_H
+#define FFRT_API_CPP_SCHED_POLICY_H
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "c/type_def_ext.h"
+
+namespace ffrt {
+/**
+ * @brief Ready task handed to a sched_policy.
+ *
+ * The policy only orders tasks: it must hand every task pushed back exactly once, unchanged, from pop or steal.
+ */
+struct ready_task {
+    void* handle = nullptr; // opaque, nullptr when no task is returned
+    uint64_t id = 0; // increases with task creation
+    ffrt_task_priority_t priority = ffrt_task_priority_normal;
+    uint64_t deadline_us = 0; // absolute steady clock deadline, 0 if none
+};
+
+/**
+ * @brief Policy ordering the ready tasks of one QoS, replacing the built-in run queue of the QoS.
+ *
+ * All methods are called with the run queue lock of the QoS held, so a policy needs no locking of its own,
+ * and should be fast since workers of the QoS serialize on that lock. Methods must not throw or call into ffrt.
+ */
+class sched_policy {
+public:
+    virtual ~sched_policy() = default;
+
+    virtual void push(const ready_task& task) = 0;
+
+    // returns a task whose handle is nullptr when empty
+    virtual ready_task pop() = 0;
+
+    // picks a task for a worker of another QoS helping this one, as in the energy saving sched mode
+    virtual ready_task steal()
+    {
+        return pop();
+    }
+
+    virtual size_t size() const = 0;
+};
+
+/**
+ * @brief Sets the policy ordering the ready tasks of a QoS.
+ *
+ * Tasks already queued are moved to the new policy, in the order the old one hands them out. Passing nullptr
+ * restores the built-in run queue. A policy set this way takes precedence over ffrt_set_sched_policy.
+ *
+ * @param qos_ Indicates the QoS.
+ * @param policy Indicates the policy, owned by ffrt from now on.
+ * @return Returns ffrt_success if the policy is set; returns ffrt_error_inval if the QoS is invalid.
+ */
+int set_sched_policy(qos qos_, std::unique_ptr<sched_policy> policy);
+} // namespace ffrt
+#endif // FFRT_API_CPP_SCHED_POLICY_H
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_SEMAPHORE_H
+#define FFRT_API_CPP_SEMAPHORE_H
+#include <cstddef>
+#include <cstdint>
+#include "c/semaphore.h"
+
+namespace ffrt {
+/**
+ * @brief Counting semaphore with the interface of std::counting_semaphore.
+ *
+ * When called inside an FFRT task, acquire suspends the task instead of the worker thread.
+ */
+template <std::ptrdiff_t LeastMaxValue = INT32_MAX>
+class counting_semaphore : public ffrt_sem_t {
+    static_assert(LeastMaxValue >= 0 && LeastMaxValue <= UINT32_MAX, "LeastMaxValue out of range");
+
+public:
+    explicit counting_semaphore(std::ptrdiff_t desired)
+    {
+        ffrt_sem_init(this, static_cast<uint32_t>(desired));
+    }
+
+    ~counting_semaphore()
+    {
+        ffrt_sem_destroy(this);
+    }
+
+    counting_semaphore(const counting_semaphore&) = delete;
+    void operator=(const counting_semaphore&) = delete;
+
+    static constexpr std::ptrdiff_t max() noexcept
+    {
+        return LeastMaxValue;
+    }
+
+    inline void release(std::ptrdiff_t update = 1)
+    {
+        ffrt_sem_post(this, static_cast<uint32_t>(update));
+    }
+
+    inline void acquire()
+    {
+        ffrt_sem_wait(this);
+    }
+
+    inline bool try_acquire() noexcept
+    {
+        return ffrt_sem_trywait(this) == ffrt_success;
+    }
+};
+
+using binary_semaphore = counting_semaphore<1>;
+} // namespace ffrt
+#endif // FFRT_API_CPP_SEMAPHORE_H
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_TASK_GRAPH_H
+#define FFRT_API_CPP_TASK_GRAPH_H
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "cpp/condition_variable.h"
+#include "cpp/mutex.h"
+#include "cpp/task.h"
+
+namespace ffrt {
+namespace detail {
+struct graph_node {
+    std::function<void()> fn;
+    qos qos_;
+    std::vector<uint32_t> succs;
+    uint32_t preds {0};
+};
+
+/*
+ * One instantiated graph. Launches run one after another, so a launch sees every write of the launch before it
+ * just like tasks submitted with the same data dependencies twice would. Within a launch, a node becomes ready when
+ * the counter holding its number of predecessors drops to zero.
+ */
+class graph_exec_state : public std::enable_shared_from_this<graph_exec_state> {
+public:
+    explicit graph_exec_state(std::shared_ptr<const std::vector<graph_node>> nodes)
+        : m_nodes(std::move(nodes)), m_counters(new std::atomic<uint32_t>[m_nodes->size()])
+    {
+        for (uint32_t i = 0; i < m_nodes->size(); i++) {
+            if ((*m_nodes)[i].preds == 0) {
+                m_roots.push_back(i);
+            }
+        }
+    }
+
+    void launch()
+    {
+        std::unique_lock<mutex> lk(m_mtx);
+        if (m_running) {
+            ++m_pending;
+            return;
+        }
+        m_running = true;
+        lk.unlock();
+        start();
+    }
+
+    void wait()
+    {
+        std::unique_lock<mutex> lk(m_mtx);
+        m_cv.wait(lk, [this] { return !m_running; });
+    }
+
+private:
+    void start()
+    {
+        if (m_nodes->empty()) {
+            done();
+            return;
+        }
+        for (uint32_t i = 0; i < m_nodes->size(); i++) {
+            m_counters[i].store((*m_nodes)[i].preds, std::memory_order_relaxed);
+        }
+        m_remaining.store(static_cast<uint32_t>(m_nodes->size()), std::memory_order_release);
+        for (uint32_t i : m_roots) {
+            spawn(i);
+        }
+    }
+
+    void spawn(uint32_t idx)
+    {
+        auto self = shared_from_this();
+        submit([self, idx] { self->run(idx); }, task_attr().qos((*m_nodes)[idx].qos_));
+    }
+
+    // the last successor made ready by a node runs on the same task when it has the same QoS
+    void run(uint32_t idx)
+    {
+        while (true) {
+            const graph_node& node = (*m_nodes)[idx];
+            node.fn();
+            int next = -1;
+            for (uint32_t s : node.succs) {
+                if (m_counters[s].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (next >= 0) {
+                    spawn(static_cast<uint32_t>(next));
+                }
+                next = static_cast<int>(s);
+            }
+            if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                done();
+                return;
+            }
+            if (next < 0) {
+                return;
+            }
+            if ((*m_nodes)[next].qos_ != node.qos_) {
+                spawn(static_cast<uint32_t>(next));
+                return;
+            }
+            idx = static_cast<uint32_t>(next);
+        }
+    }
+
+    void done()
+    {
+        std::unique_lock<mutex> lk(m_mtx);
+        if (m_pending > 0) {
+            --m_pending;
+            lk.unlock();
+            start();
+            return;
+        }
+        m_running = false;
+        m_cv.notify_all();
+    }
+
+    std::shared_ptr<const std::vector<graph_node>> m_nodes;
+    std::unique_ptr<std::atomic<uint32_t>[]> m_counters;
+    std::vector<uint32_t> m_roots;
+    std::atomic<uint32_t> m_remaining {0};
+    mutex m_mtx;
+    condition_variable m_cv;
+    bool m_running {false};
+    uint32_t m_pending {0};
+};
+} // namespace detail
+
+/**
+ * @brief Instantiated task graph, launched as many times as needed without resolving any dependency again.
+ */
+class graph_exec {
+public:
+    graph_exec(const graph_exec&) = delete;
+    graph_exec& operator=(const graph_exec&) = delete;
+    graph_exec(graph_exec&&) = default;
+
+    graph_exec& operator=(graph_exec&& other)
+    {
+        if (this != &other) {
+            if (m_state) {
+                m_state->wait();
+            }
+            m_state = std::move(other.m_state);
+        }
+        return *this;
+    }
+
+    ~graph_exec()
+    {
+        if (m_state) {
+            m_state->wait();
+        }
+    }
+
+    /**
+     * @brief Submits all tasks of the graph without waiting for them.
+     *
+     * A launch starts once the previous launch of the same graph_exec is done.
+     */
+    void launch()
+    {
+        m_state->launch();
+    }
+
+    /**
+     * @brief Waits until all launches are done.
+     */
+    void wait()
+    {
+        m_state->wait();
+    }
+
+private:
+    friend class task_graph;
+    explicit graph_exec(std::shared_ptr<const std::vector<detail::graph_node>> nodes)
+        : m_state(std::make_shared<detail::graph_exec_state>(std::move(nodes)))
+    {
+    }
+
+    std::shared_ptr<detail::graph_exec_state> m_state;
+};
+
+/**
+ * @brief Records a DAG of tasks once, to be replayed through graph_exec.
+ *
+ * Tasks are captured with the same data dependencies as ffrt::submit and the edges between them are resolved
+ * when captured: a reader follows the last writer of its data, a writer follows the last writer and every
+ * reader since. Launching the graph then only counts down predecessors, with no dependency lookup.
+ * Graph tasks are not ordered against tasks submitted outside the graph, even on the same data.
+ */
+class task_graph {
+public:
+    /**
+     * @brief Captures a task.
+     *
+     * @param func Indicates the task function, called once per launch.
+     * @param in_deps Indicates the data read by the task.
+     * @param out_deps Indicates the data written by the task.
+     * @param qos_ Indicates the QoS the task is submitted with.
+     * @return Returns the index of the task in the graph.
+     */
+    uint32_t submit(std::function<void()> func, std::initializer_list<const void*> in_deps,
+        std::initializer_list<const void*> out_deps, qos qos_ = qos_inherit)
+    {
+        return capture(std::move(func), in_deps.begin(), in_deps.end(), out_deps.begin(), out_deps.end(), qos_);
+    }
+
+    uint32_t submit(std::function<void()> func, const std::vector<const void*>& in_deps,
+        const std::vector<const void*>& out_deps, qos qos_ = qos_inherit)
+    {
+        return capture(std::move(func), in_deps.data(), in_deps.data() + in_deps.size(), out_deps.data(),
+            out_deps.data() + out_deps.size(), qos_);
+    }
+
+    size_t size() const
+    {
+        return m_nodes.size();
+    }
+
+    /**
+     * @brief Creates an executable copy of the graph; later captures do not change it.
+     */
+    graph_exec instantiate() const
+    {
+        return graph_exec(std::make_shared<const std::vector<detail::graph_node>>(m_nodes));
+    }
+
+private:
+    struct data_state {
+        int writer {-1};
+        std::vector<uint32_t> readers;
+    };
+
+    uint32_t capture(std::function<void()>&& func, const void* const* inBegin, const void* const* inEnd,
+        const void* const* outBegin, const void* const* outEnd, qos qos_)
+    {
+        uint32_t idx = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.push_back(detail::graph_node {std::move(func), qos_, {}, 0});
+        for (auto it = inBegin; it != inEnd; ++it) {
+            data_state& d = m_data[*it];
+            if (d.writer >= 0) {
+                add_edge(static_cast<uint32_t>(d.writer), idx);
+            }
+        }
+        for (auto it = outBegin; it != outEnd; ++it) {
+            data_state& d = m_data[*it];
+            if (d.writer >= 0) {
+                add_edge(static_cast<uint32_t>(d.writer), idx);
+            }
+            for (uint32_t r : d.readers) {
+                add_edge(r, idx);
+            }
+            d.readers.clear();
+            d.writer = static_cast<int>(idx);
+        }
+        // recorded after the outputs so that a task reading and writing the same data is not its own reader
+        for (auto it = inBegin; it != inEnd; ++it) {
+            data_state& d = m_data[*it];
+            if (d.writer != static_cast<int>(idx)) {
+                d.readers.push_back(idx);
+            }
+        }
+        return idx;
+    }
+
+    void add_edge(uint32_t from, uint32_t to)
+    {
+        if (from == to) {
+            return;
+        }
+        std::vector<uint32_t>& succs = m_nodes[from].succs;
+        if (!succs.empty() && succs.back() == to) {
+            return;
+        }
+        succs.push_back(to);
+        ++m_nodes[to].preds;
+    }
+
+    std::vector<detail::graph_node> m_nodes;
+    std::unordered_map<const void*, data_state> m_data;
+};
+} // namespace ffrt
+#endif // FFRT_API_CPP_TASK_GRAPH_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FFRT_API_CPP_TASK_GROUP_H
+#define FFRT_API_CPP_TASK_GROUP_H
+#include <functional>
+#include <initializer_list>
+#include <vector>
+#include "c/task_ext.h"
+#include "cpp/task.h"
+
+namespace ffrt {
+/**
+ * @brief Owns the tasks submitted through it and every task they submit in turn.
+ *
+ * cancel() drops the tasks of the group that have not started yet, running ones can stop early by polling
+ * is_cancelled(). wait() joins the whole group; the destructor waits as well.
+ */
+class task_group {
+public:
+    task_group() : m_group(ffrt_task_group_create())
+    {
+    }
+
+    ~task_group()
+    {
+        ffrt_task_group_wait(m_group);
+        ffrt_task_group_destroy(m_group);
+    }
+
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+
+    /**
+     * @brief Submits a task to the group without input and output dependencies.
+     *
+     * @param func Indicates a task executor function closure.
+     * @param attr Indicates a task attribute.
+     */
+    void submit(std::function<void()>&& func, const task_attr& attr = {})
+    {
+        ffrt_task_group_submit(m_group, create_function_wrapper(std::move(func)), nullptr, nullptr, &attr);
+    }
+
+    /**
+     * @brief Submits a task to the group with input and output dependencies.
+     *
+     * @param func Indicates a task executor function closure.
+     * @param in_deps Indicates the input dependencies.
+     * @param out_deps Indicates the output dependencies.
+     * @param attr Indicates a task attribute.
+     */
+    void submit(std::function<void()>&& func, std::initializer_list<dependence> in_deps,
+        std::initializer_list<dependence> out_deps, const task_attr& attr = {})
+    {
+        ffrt_deps_t in {static_cast<uint32_t>(in_deps.size()), in_deps.begin()};
+        ffrt_deps_t out {static_cast<uint32_t>(out_deps.size()), out_deps.begin()};
+        ffrt_task_group_submit(m_group, create_function_wrapper(std::move(func)), &in, &out, &attr);
+    }
+
+    void submit(std::function<void()>&& func, const std::vector<dependence>& in_deps,
+        const std::vector<dependence>& out_deps, const task_attr& attr = {})
+    {
+        ffrt_deps_t in {static_cast<uint32_t>(in_deps.size()), in_deps.data()};
+        ffrt_deps_t out {static_cast<uint32_t>(out_deps.size()), out_deps.data()};
+        ffrt_task_group_submit(m_group, create_function_wrapper(std::move(func)), &in, &out, &attr);
+    }
+
+    /**
+     * @brief Cancels the group. Tasks submitted to it afterwards are dropped as well.
+     */
+    void cancel()
+    {
+        ffrt_task_group_cancel(m_group);
+    }
+
+    bool is_cancelled() const
+    {
+        return ffrt_task_group_is_cancelled(m_group);
+    }
+
+    /**
+     * @brief Waits until all tasks of the group are done or dropped. Must not be called from a task of the group.
+     *
+     * @return Returns ffrt_success if the wait succeeds; returns ffrt_error if called from a task of the group.
+     */
+    int wait()
+    {
+        return ffrt_task_group_wait(m_group);
+    }
+
+private:
+    ffrt_task_group_t m_group;
+};
+
+namespace this_task {
+/**
+ * @brief Checks whether the task group of the current task is cancelled.
+ *
+ * @return Returns true if the current task belongs to a cancelled ffrt::task_group; returns false otherwise.
+ */
+static inline bool is_cancelled()
+{
+    return ffrt_this_task_is_cancelled();
+}
+} // namespace this_task
+} // namespace ffrt
+#endif // FFRT_API_CPP_TASK_GROUP_H
@@ -18,14 +18,27 @@
 #ifdef __cplusplus
 #include "c/ffrt_dump.h"
 #include "c/queue_ext.h"
+#include "c/shared_mutex_ext.h"
 #include "cpp/thread.h"
 #include "cpp/future.h"
+#include "cpp/channel.h"
+#include "cpp/semaphore.h"
+#include "cpp/fair_mutex.h"
+#include "cpp/barrier.h"
+#include "cpp/call_once.h"
+#include "cpp/parallel.h"
+#include "cpp/sched_policy.h"
+#include "cpp/task_graph.h"
+#include "cpp/task_group.h"
 #include "cpp/task_ext.h"
 #include "cpp/deadline.h"
 #include "cpp/qos_convert.h"
 #else
 #include "c/task_ext.h"
 #include "c/queue_ext.h"
+#include "c/shared_mutex_ext.h"
+#include "c/semaphore.h"
+#include "c/barrier.h"
 #include "c/thread.h"
 #include "c/executor_task.h"
 #include "c/ffrt_dump.h"
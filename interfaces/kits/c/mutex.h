@@ -41,6 +41,7 @@
 #ifndef FFRT_API_C_MUTEX_H
 #define FFRT_API_C_MUTEX_H
 
+#include <time.h>
 #include "type_def.h"
 
 /**
@@ -158,6 +159,23 @@ FFRT_C_API int ffrt_mutex_unlock(ffrt_mutex_t* mutex);
  */
 FFRT_C_API int ffrt_mutex_trylock(ffrt_mutex_t* mutex);
 
+/**
+ * @brief Locks a mutex, waiting no later than a given time point.
+ *
+ * If the mutex is held by another thread, blocks the calling thread until the mutex
+ * becomes available or `time_point` is reached. When called in a task, the task is
+ * suspended instead of the worker thread.
+ *
+ * @param mutex Indicates a pointer to the mutex.
+ * @param time_point Indicates the absolute time point of the steady clock at which the wait expires.
+ * @return `ffrt_success` if the mutex is locked;
+ *         `ffrt_error_timedout` if `time_point` is reached before the mutex is locked;
+ *         `ffrt_error_inval` otherwise.
+ * @see ffrt_mutex_lock
+ * @since 23
+ */
+FFRT_C_API int ffrt_mutex_timedlock(ffrt_mutex_t* mutex, const struct timespec* time_point);
+
 /**
  * @brief Destroys a mutex.
  *
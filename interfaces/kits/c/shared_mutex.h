@@ -40,6 +40,7 @@
 #ifndef FFRT_API_C_SHARED_MUTEX_H
 #define FFRT_API_C_SHARED_MUTEX_H
 
+#include <time.h>
 #include "type_def.h"
 
 /**
@@ -86,6 +87,22 @@ FFRT_C_API int ffrt_rwlock_wrlock(ffrt_rwlock_t* rwlock);
  */
 FFRT_C_API int ffrt_rwlock_trywrlock(ffrt_rwlock_t* rwlock);
 
+/**
+ * @brief Locks a write lock, waiting no later than a given time point.
+ *
+ * Blocks the calling thread until the write lock is available or `time_point` is reached.
+ * When called in a task, the task is suspended instead of the worker thread.
+ *
+ * @param rwlock Indicates a pointer to the rwlock.
+ * @param time_point Indicates the absolute time point of the steady clock at which the wait expires.
+ * @return `ffrt_success` if the rwlock is locked;
+ *         `ffrt_error_timedout` if `time_point` is reached before the rwlock is locked;
+ *         `ffrt_error_inval` otherwise.
+ * @see ffrt_rwlock_wrlock
+ * @since 23
+ */
+FFRT_C_API int ffrt_rwlock_timedwrlock(ffrt_rwlock_t* rwlock, const struct timespec* time_point);
+
 /**
  * @brief Locks a read lock.
  *
@@ -116,12 +133,28 @@ FFRT_C_API int ffrt_rwlock_rdlock(ffrt_rwlock_t* rwlock);
  */
 FFRT_C_API int ffrt_rwlock_tryrdlock(ffrt_rwlock_t* rwlock);
 
+/**
+ * @brief Locks a read lock, waiting no later than a given time point.
+ *
+ * Blocks the calling thread until a read lock is available or `time_point` is reached.
+ * When called in a task, the task is suspended instead of the worker thread.
+ *
+ * @param rwlock Indicates a pointer to the rwlock.
+ * @param time_point Indicates the absolute time point of the steady clock at which the wait expires.
+ * @return `ffrt_success` if the rwlock is locked;
+ *         `ffrt_error_timedout` if `time_point` is reached before the rwlock is locked;
+ *         `ffrt_error_inval` otherwise.
+ * @see ffrt_rwlock_rdlock
+ * @since 23
+ */
+FFRT_C_API int ffrt_rwlock_timedrdlock(ffrt_rwlock_t* rwlock, const struct timespec* time_point);
+
 /**
  * @brief Unlocks a rwlock.
  *
  * The rwlock must be held by the calling thread, having been previously locked by
- * {@link ffrt_rwlock_rdlock}, {@link ffrt_rwlock_tryrdlock}, {@link ffrt_rwlock_wrlock},
- * or {@link ffrt_rwlock_trywrlock}.
+ * {@link ffrt_rwlock_rdlock}, {@link ffrt_rwlock_tryrdlock}, {@link ffrt_rwlock_timedrdlock},
+ * {@link ffrt_rwlock_wrlock}, {@link ffrt_rwlock_trywrlock} or {@link ffrt_rwlock_timedwrlock}.
  *
  * @param rwlock Indicates a pointer to the rwlock.
  * @return `ffrt_success` if the rwlock is unlocked;
@@ -252,22 +252,7 @@ private:
             return cv_status::timeout;
         }
 
-        auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-            std::chrono::steady_clock::now().time_since_epoch());
-        auto dur_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dur);
-
-        std::chrono::nanoseconds ns;
-        if (now_ns.count() > (std::chrono::nanoseconds::max)().count() - dur_ns.count()) {
-            ns = (std::chrono::nanoseconds::max)();
-        } else {
-            ns = now_ns + dur_ns;
-        }
-
-        timespec ts;
-        ts.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(ns).count();
-        ns -= std::chrono::seconds(ts.tv_sec);
-        ts.tv_nsec = static_cast<long>(ns.count());
-
+        timespec ts = detail::to_deadline(dur);
         auto ret = ffrt_cond_timedwait(this, lk.mutex(), &ts);
         if (ret == ffrt_success) {
             return cv_status::no_timeout;
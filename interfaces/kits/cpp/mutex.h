@@ -40,6 +40,8 @@
 #ifndef FFRT_API_CPP_MUTEX_H
 #define FFRT_API_CPP_MUTEX_H
 
+#include <chrono>
+#include <time.h>
 #include "c/mutex.h"
 
 #if defined(__OHOS__) && defined(__has_include) && __has_include("c/mutex_ext.h")
@@ -58,6 +60,33 @@ constexpr int WAIT = 2;
 #endif
 
 namespace ffrt {
+namespace detail {
+/**
+ * @brief Converts a timeout duration to the absolute time point of the steady clock taken by the timed C APIs.
+ */
+template <typename Rep, typename Period>
+inline timespec to_deadline(const std::chrono::duration<Rep, Period>& timeout_duration) noexcept
+{
+    auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+    auto dur_ns = timeout_duration <= timeout_duration.zero() ? std::chrono::nanoseconds::zero() :
+        std::chrono::duration_cast<std::chrono::nanoseconds>(timeout_duration);
+
+    std::chrono::nanoseconds ns;
+    if (now_ns.count() > (std::chrono::nanoseconds::max)().count() - dur_ns.count()) {
+        ns = (std::chrono::nanoseconds::max)();
+    } else {
+        ns = now_ns + dur_ns;
+    }
+
+    timespec ts;
+    ts.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(ns).count();
+    ns -= std::chrono::seconds(ts.tv_sec);
+    ts.tv_nsec = static_cast<long>(ns.count());
+    return ts;
+}
+} // namespace detail
+
 /**
  * @class mutex
  * @brief Provides a standard mutex for thread synchronization.
@@ -115,6 +144,40 @@ public:
 #endif
     }
 
+    /**
+     * @brief Attempts to lock the mutex, waiting for at most the given duration.
+     *
+     * When called in a task, the task is suspended instead of the worker thread while waiting.
+     *
+     * @param timeout_duration The maximum duration to wait for.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout_duration)
+    {
+#if FFRT_SUPPORT_FAST_MUTEX
+        if (try_lock()) {
+            return true;
+        }
+#endif
+        timespec ts = detail::to_deadline(timeout_duration);
+        return ffrt_mutex_timedlock(this, &ts) == ffrt_success;
+    }
+
+    /**
+     * @brief Attempts to lock the mutex, waiting no later than the given time point.
+     *
+     * @param timeout_time The time point at which the wait expires.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& timeout_time)
+    {
+        return try_lock_for(timeout_time - Clock::now());
+    }
+
     /**
      * @brief Locks the mutex.
      *
@@ -210,6 +273,35 @@ public:
         return ffrt_mutex_trylock(this) == ffrt_success ? true : false;
     }
 
+    /**
+     * @brief Attempts to lock the recursive mutex, waiting for at most the given duration.
+     *
+     * When called in a task, the task is suspended instead of the worker thread while waiting.
+     *
+     * @param timeout_duration The maximum duration to wait for.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout_duration)
+    {
+        timespec ts = detail::to_deadline(timeout_duration);
+        return ffrt_mutex_timedlock(this, &ts) == ffrt_success;
+    }
+
+    /**
+     * @brief Attempts to lock the recursive mutex, waiting no later than the given time point.
+     *
+     * @param timeout_time The time point at which the wait expires.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& timeout_time)
+    {
+        return try_lock_for(timeout_time - Clock::now());
+    }
+
     /**
      * @brief Locks the recursive mutex.
      *
@@ -40,7 +40,9 @@
 #ifndef FFRT_API_CPP_SHARED_MUTEX_H
 #define FFRT_API_CPP_SHARED_MUTEX_H
 
+#include <chrono>
 #include "c/shared_mutex.h"
+#include "mutex.h"
 
 namespace ffrt {
 /**
@@ -65,6 +67,17 @@ public:
         ffrt_rwlock_init(this, nullptr);
     }
 
+    /**
+     * @brief Constructs a shared_mutex object with the given attribute, such as a read-biased one.
+     *
+     * @param attr The rwlock attribute initialized by {@link ffrt_rwlockattr_init}.
+     * @since 23
+     */
+    explicit shared_mutex(const ffrt_rwlockattr_t& attr)
+    {
+        ffrt_rwlock_init(this, &attr);
+    }
+
     /**
      * @brief Destroys the shared_mutex object and releases the underlying lock.
      *
@@ -106,6 +119,35 @@ public:
         return ffrt_rwlock_trywrlock(this) == ffrt_success ? true : false;
     }
 
+    /**
+     * @brief Attempts to acquire an exclusive lock, waiting for at most the given duration.
+     *
+     * When called in a task, the task is suspended instead of the worker thread while waiting.
+     *
+     * @param timeout_duration The maximum duration to wait for.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout_duration)
+    {
+        timespec ts = detail::to_deadline(timeout_duration);
+        return ffrt_rwlock_timedwrlock(this, &ts) == ffrt_success;
+    }
+
+    /**
+     * @brief Attempts to acquire an exclusive lock, waiting no later than the given time point.
+     *
+     * @param timeout_time The time point at which the wait expires.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& timeout_time)
+    {
+        return try_lock_for(timeout_time - Clock::now());
+    }
+
     /**
      * @brief Releases the exclusive lock.
      *
@@ -137,6 +179,35 @@ public:
         return ffrt_rwlock_tryrdlock(this) == ffrt_success ? true : false;
     }
 
+    /**
+     * @brief Attempts to acquire a shared lock, waiting for at most the given duration.
+     *
+     * When called in a task, the task is suspended instead of the worker thread while waiting.
+     *
+     * @param timeout_duration The maximum duration to wait for.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_shared_for(const std::chrono::duration<Rep, Period>& timeout_duration)
+    {
+        timespec ts = detail::to_deadline(timeout_duration);
+        return ffrt_rwlock_timedrdlock(this, &ts) == ffrt_success;
+    }
+
+    /**
+     * @brief Attempts to acquire a shared lock, waiting no later than the given time point.
+     *
+     * @param timeout_time The time point at which the wait expires.
+     * @return true if the lock is successfully acquired, false otherwise.
+     * @since 23
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_shared_until(const std::chrono::time_point<Clock, Duration>& timeout_time)
+    {
+        return try_lock_shared_for(timeout_time - Clock::now());
+    }
+
     /**
      * @brief Releases the shared lock.
      *
@@ -299,6 +299,30 @@ void ffrt_task_attr_set_notify_worker(ffrt_task_attr_t* attr, bool notify)
     (reinterpret_cast<ffrt::task_attr_private *>(attr))->notifyWorker_ = notify;
 }
 
+API_ATTRIBUTE((visibility("default")))
+void ffrt_task_attr_set_priority(ffrt_task_attr_t* attr, ffrt_task_priority_t priority)
+{
+    if (unlikely(!attr)) {
+        FFRT_LOGE("attr should be a valid address");
+        return;
+    }
+    if (priority < ffrt_task_priority_high || priority > ffrt_task_priority_low) {
+        FFRT_LOGE("priority should be a valid priority");
+        return;
+    }
+    (reinterpret_cast<ffrt::task_attr_private *>(attr))->taskPrio_ = priority;
+}
+
+API_ATTRIBUTE((visibility("default")))
+ffrt_task_priority_t ffrt_task_attr_get_priority(const ffrt_task_attr_t* attr)
+{
+    if (unlikely(!attr)) {
+        FFRT_LOGE("attr should be a valid address");
+        return ffrt_task_priority_normal;
+    }
+    return (reinterpret_cast<const ffrt::task_attr_private *>(attr))->taskPrio_;
+}
+
 API_ATTRIBUTE((visibility("default")))
 void ffrt_task_attr_set_queue_priority(ffrt_task_attr_t* attr, ffrt_queue_priority_t priority)
 {
@@ -664,6 +688,19 @@ int ffrt_executor_task_cancel(ffrt_executor_task_t* task, const ffrt_qos_t qos)
     return static_cast<int>(ret);
 }
 
+API_ATTRIBUTE((visibility("default")))
+int ffrt_executor_task_set_max_concurrency(ffrt_qos_t qos, uint32_t num)
+{
+    if (qos < ffrt::QoS::Min() || qos >= ffrt::QoS::Max()) {
+        FFRT_LOGE("qos [%d] is invalid", qos);
+        return ffrt_error_inval;
+    }
+    FFRT_COND_DO_ERR((num == 0 || num > static_cast<uint32_t>(INT_MAX)), return ffrt_error_inval,
+        "max concurrency [%u] is invalid", num);
+    ffrt::FFRTFacade::GetScheduler().GetScheduler(ffrt::QoS(qos)).SetUVTaskMaxConcurrency(num);
+    return ffrt_success;
+}
+
 API_ATTRIBUTE((visibility("default")))
 void* ffrt_get_cur_task(void)
 {
@@ -759,6 +796,18 @@ void ffrt_disable_worker_escape(void)
     ffrt::FFRTFacade::GetExecuteUnit().SetEscapeDisable();
 }
 
+API_ATTRIBUTE((visibility("default")))
+int ffrt_enable_worker_pressure_scaling(uint64_t interval_ms, uint32_t stall_threshold_pct)
+{
+    return ffrt::FFRTFacade::GetExecuteUnit().SetPressureScalingEnable(interval_ms, stall_threshold_pct);
+}
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_disable_worker_pressure_scaling(void)
+{
+    ffrt::FFRTFacade::GetExecuteUnit().SetPressureScalingDisable();
+}
+
 API_ATTRIBUTE((visibility("default")))
 void ffrt_set_sched_mode(ffrt_qos_t qos, ffrt_sched_mode mode)
 {
@@ -769,6 +818,71 @@ void ffrt_set_sched_mode(ffrt_qos_t qos, ffrt_sched_mode mode)
     ffrt::FFRTFacade::GetExecuteUnit().SetSchedMode(ffrt::QoS(qos), static_cast<ffrt::sched_mode_type>(mode));
 }
 
+API_ATTRIBUTE((visibility("default")))
+int ffrt_set_sched_policy(ffrt_qos_t qos, ffrt_sched_policy policy)
+{
+    if (qos < ffrt::QoS::Min() || qos >= ffrt::QoS::Max()) {
+        FFRT_LOGE("qos [%d] is invalid", qos);
+        return ffrt_error_inval;
+    }
+    if (!ffrt::FFRTFacade::GetScheduler().GetScheduler(ffrt::QoS(qos)).SetPolicy(policy)) {
+        FFRT_LOGE("sched policy [%d] is not supported", policy);
+        return ffrt_error_inval;
+    }
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_task_attr_set_deadline(ffrt_task_attr_t* attr, uint64_t deadline_us)
+{
+    if (unlikely(!attr)) {
+        FFRT_LOGE("attr should be a valid address");
+        return;
+    }
+    (reinterpret_cast<ffrt::task_attr_private *>(attr))->deadlineUs_ = deadline_us;
+}
+
+API_ATTRIBUTE((visibility("default")))
+uint64_t ffrt_task_attr_get_deadline(const ffrt_task_attr_t* attr)
+{
+    if (unlikely(!attr)) {
+        FFRT_LOGE("attr should be a valid address");
+        return 0;
+    }
+    return (reinterpret_cast<const ffrt::task_attr_private *>(attr))->deadlineUs_;
+}
+
+API_ATTRIBUTE((visibility("default")))
+uint64_t ffrt_get_deadline_miss_count(ffrt_qos_t qos)
+{
+    if (qos < ffrt::QoS::Min() || qos >= ffrt::QoS::Max()) {
+        FFRT_LOGE("qos [%d] is invalid", qos);
+        return 0;
+    }
+    return ffrt::FFRTFacade::GetScheduler().GetScheduler(ffrt::QoS(qos)).deadlineMissCnt.load(
+        std::memory_order_relaxed);
+}
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_task_attr_set_affinity_hint(ffrt_task_attr_t* attr, uint64_t cpu_mask)
+{
+    if (unlikely(!attr)) {
+        FFRT_LOGE("attr should be a valid address");
+        return;
+    }
+    (reinterpret_cast<ffrt::task_attr_private *>(attr))->affinityHint_ = cpu_mask;
+}
+
+API_ATTRIBUTE((visibility("default")))
+uint64_t ffrt_task_attr_get_affinity_hint(const ffrt_task_attr_t* attr)
+{
+    if (unlikely(!attr)) {
+        FFRT_LOGE("attr should be a valid address");
+        return 0;
+    }
+    return (reinterpret_cast<const ffrt::task_attr_private *>(attr))->affinityHint_;
+}
+
 API_ATTRIBUTE((visibility("default")))
 void ffrt_task_attr_set_group(ffrt_task_attr_t *attr)
 {
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/task_group.h"
+#include "c/task_ext.h"
+#include "cpp/task.h"
+#include "dfx/log/ffrt_log_api.h"
+#include "internal_inc/osal.h"
+#include "sched/execute_ctx.h"
+#include "tm/cpu_task.h"
+
+namespace ffrt {
+void TaskGroup::Leave()
+{
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<mutex> lk(mtx);
+        cv.notify_all();
+    }
+    DecRef();
+}
+
+void TaskGroup::Wait()
+{
+    std::unique_lock<mutex> lk(mtx);
+    cv.wait(lk, [this] { return pending.load(std::memory_order_acquire) == 0; });
+}
+} // namespace ffrt
+
+namespace {
+inline ffrt::CPUEUTask* CurrentCPUTask()
+{
+    ffrt::TaskBase* task = ffrt::ExecuteCtx::Cur()->task;
+    return (task != nullptr && task->type == ffrt_normal_task) ? static_cast<ffrt::CPUEUTask*>(task) : nullptr;
+}
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+API_ATTRIBUTE((visibility("default")))
+ffrt_task_group_t ffrt_task_group_create(void)
+{
+    return new ffrt::TaskGroup();
+}
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_task_group_destroy(ffrt_task_group_t group)
+{
+    FFRT_COND_DO_ERR((group == nullptr), return, "input task group is invalid");
+    static_cast<ffrt::TaskGroup*>(group)->DecRef();
+}
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_task_group_submit(ffrt_task_group_t group, ffrt_function_header_t* f, const ffrt_deps_t* in_deps,
+    const ffrt_deps_t* out_deps, const ffrt_task_attr_t* attr)
+{
+    FFRT_COND_DO_ERR((group == nullptr), return, "input task group is invalid");
+    // the caller's attr may be shared with other submits, the group is set on a copy
+    ffrt::task_attr_private local = (attr != nullptr) ?
+        *reinterpret_cast<const ffrt::task_attr_private*>(attr) : ffrt::task_attr_private();
+    local.group_ = static_cast<ffrt::TaskGroup*>(group);
+    ffrt_submit_base(f, in_deps, out_deps, reinterpret_cast<ffrt_task_attr_t*>(&local));
+}
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_task_group_cancel(ffrt_task_group_t group)
+{
+    FFRT_COND_DO_ERR((group == nullptr), return, "input task group is invalid");
+    static_cast<ffrt::TaskGroup*>(group)->Cancel();
+}
+
+API_ATTRIBUTE((visibility("default")))
+bool ffrt_task_group_is_cancelled(ffrt_task_group_t group)
+{
+    FFRT_COND_DO_ERR((group == nullptr), return false, "input task group is invalid");
+    return static_cast<ffrt::TaskGroup*>(group)->IsCancelled();
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_task_group_wait(ffrt_task_group_t group)
+{
+    FFRT_COND_DO_ERR((group == nullptr), return ffrt_error_inval, "input task group is invalid");
+    ffrt::CPUEUTask* task = CurrentCPUTask();
+    FFRT_COND_DO_ERR((task != nullptr && task->group_ == group), return ffrt_error,
+        "a task can not wait for its own task group");
+    static_cast<ffrt::TaskGroup*>(group)->Wait();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+bool ffrt_this_task_is_cancelled(void)
+{
+    ffrt::CPUEUTask* task = CurrentCPUTask();
+    return task != nullptr && task->group_ != nullptr && task->group_->IsCancelled();
+}
+#ifdef __cplusplus
+}
+#endif
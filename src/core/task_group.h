@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_TASK_GROUP_H
+#define FFRT_TASK_GROUP_H
+#include <atomic>
+#include <cstdint>
+#include "cpp/condition_variable.h"
+#include "cpp/mutex.h"
+
+namespace ffrt {
+/*
+ * Tasks of a group and all their descendants hold the group until they are done. Cancelling the group only sets
+ * a flag: queued tasks see it when dequeued and are dropped without running, running ones poll it.
+ */
+class TaskGroup {
+public:
+    void Join()
+    {
+        refs.fetch_add(1, std::memory_order_relaxed);
+        pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Leave();
+
+    void Cancel()
+    {
+        cancelled.store(true, std::memory_order_release);
+    }
+
+    bool IsCancelled() const
+    {
+        return cancelled.load(std::memory_order_acquire);
+    }
+
+    void Wait();
+
+    void DecRef()
+    {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+private:
+    std::atomic<bool> cancelled {false};
+    std::atomic<uint32_t> pending {0};
+    std::atomic<uint32_t> refs {1};
+    mutex mtx;
+    condition_variable cv;
+};
+} // namespace ffrt
+#endif
@@ -18,6 +18,7 @@
 #include "unwinder.h"
 #include "backtrace_local.h"
 #endif
+#include <sstream>
 #include <securec.h>
 #include "dfx/bbox/bbox.h"
 #include "internal_inc/osal.h"
@@ -25,6 +26,8 @@
 #include "dfx/trace/ffrt_trace_chain.h"
 #include "dfx/trace_record/ffrt_trace_record.h"
 #include "util/common_const.h"
+#include "sync/lock_profiler.h"
+#include "util/ffrt_facade.h"
 #include "dump.h"
 
 #ifdef FFRT_CO_BACKTRACE_OH_ENABLE
@@ -58,6 +61,24 @@ struct TimeoutCfg {
     ffrt_task_timeout_cb callback = nullptr;
 };
 
+int DumpAffinityHintInfo(char* buf, uint32_t len)
+{
+    constexpr uint64_t percent = 100;
+    std::ostringstream oss;
+    oss << "---\n" << "affinity hint\n" << "QoS HintedNum HitNum HitRate(%)\n";
+    for (int qos = QoS::Min(); qos < QoS::Max(); qos++) {
+        TaskScheduler& sched = FFRTFacade::GetScheduler().GetScheduler(QoS(qos));
+        uint64_t hinted = sched.affinityHintCnt.load(std::memory_order_relaxed);
+        if (hinted == 0) {
+            continue;
+        }
+        uint64_t hit = sched.affinityHintHitCnt.load(std::memory_order_relaxed);
+        oss << qos << " " << hinted << " " << hit << " " << hit * percent / hinted << "\n";
+    }
+    oss << "---\n";
+    return snprintf_s(buf, len, len - 1, "%s", oss.str().c_str());
+}
+
 #ifdef FFRT_CO_BACKTRACE_OH_ENABLE
 void DumpTask(CoTask* task, std::string& stackInfo, uint8_t flag)
 {
@@ -174,6 +195,12 @@ int ffrt_dump(ffrt_dump_cmd_t cmd, char *buf, uint32_t len)
         case DUMP_STOP_STAT: {
             return ffrt::FFRTTraceRecord::StatsDisable(buf);
         }
+        case DUMP_LOCK_CONTENTION_INFO: {
+            return ffrt::LockProfiler::Dump(buf, len);
+        }
+        case DUMP_AFFINITY_HINT_INFO: {
+            return ffrt::DumpAffinityHintInfo(buf, len);
+        }
         default: {
             FFRT_LOGE("ffrt_dump unsupport cmd[%d]", cmd);
         }
@@ -219,6 +246,12 @@ void ffrt_task_timeout_set_threshold(uint32_t threshold_ms)
     }
     ffrt::TimeoutCfg::Instance()->timeout.store(threshold_ms, std::memory_order_release);
 }
+
+API_ATTRIBUTE((visibility("default")))
+void ffrt_lock_profile_set_sample_rate(uint32_t rate)
+{
+    ffrt::LockProfiler::SetSampleRate(rate);
+}
 #ifdef __cplusplus
 }
 #endif
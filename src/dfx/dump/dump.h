@@ -17,6 +17,7 @@
 #define __FFRT_DUMP_H__
 #include "tm/cpu_task.h"
 namespace ffrt {
+int DumpAffinityHintInfo(char* buf, uint32_t len);
 
 #ifdef FFRT_CO_BACKTRACE_OH_ENABLE
 void DumpTask(CoTask* task, std::string& stackInfo, uint8_t flag = 0);
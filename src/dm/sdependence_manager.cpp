@@ -254,6 +254,8 @@ void SDependenceManager::onTaskDone(CPUEUTask* task)
     FFRTTraceRecord::TaskDone<ffrt_normal_task>(task->GetQos());
     FFRTTraceRecord::TaskDone<ffrt_normal_task>(task->GetQos(),  task);
     FFRT_TRACE_SCOPE(1, ontaskDone);
+    ExecuteCtx* ctx = ExecuteCtx::Cur();
+    ctx->collectNextTask = ctx->threadType_ == ThreadType::FFRT_WORKER;
     if (!(sTask->ins.empty() && sTask->outs.empty())) {
         std::lock_guard<decltype(criticalMutex_)> lg(criticalMutex_);
         FFRT_TRACE_SCOPE(1, taskDoneAfterLock);
@@ -282,6 +284,7 @@ void SDependenceManager::onTaskDone(CPUEUTask* task)
     // of freed memory on wait condition notification
     // of the parent task.
     sTask->DecChildRef();
+    ctx->collectNextTask = false;
     sTask->Finish();
 }
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eu/cpu_pressure.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+#include "dfx/log/ffrt_log_api.h"
+
+namespace {
+constexpr char PROC_CGROUP_PATH[] = "/proc/self/cgroup";
+constexpr char CGROUP2_ROOT[] = "/sys/fs/cgroup";
+constexpr char SYSTEM_PSI_PATH[] = "/proc/pressure/cpu";
+constexpr char LOADAVG_PATH[] = "/proc/loadavg";
+constexpr uint64_t PERCENT = 100;
+
+// the cgroup v2 entry is the one with hierarchy id 0, e.g. "0::/app/foo"
+std::string CgroupPsiPath()
+{
+    std::ifstream cgroupFile(PROC_CGROUP_PATH);
+    std::string line;
+    while (std::getline(cgroupFile, line)) {
+        if (line.compare(0, 3, "0::") == 0) {
+            std::string dir = line.substr(3);
+            return std::string(CGROUP2_ROOT) + (dir == "/" ? "" : dir) + "/cpu.pressure";
+        }
+    }
+    return "";
+}
+}
+
+namespace ffrt {
+CpuPressure::CpuPressure()
+{
+    uint64_t totalUs = 0;
+    std::string cgroupPath = CgroupPsiPath();
+    if (!cgroupPath.empty() && ReadStallTotal(cgroupPath, totalUs)) {
+        psiPath = cgroupPath;
+    } else if (ReadStallTotal(SYSTEM_PSI_PATH, totalUs)) {
+        psiPath = SYSTEM_PSI_PATH;
+    } else {
+        FFRT_LOGW("cpu pressure stall information is not supported");
+    }
+}
+
+// "some avg10=0.00 avg60=0.00 avg300=0.00 total=123456", total is in microseconds
+bool CpuPressure::ReadStallTotal(const std::string& path, uint64_t& totalUs)
+{
+    std::ifstream psiFile(path);
+    std::string line;
+    while (std::getline(psiFile, line)) {
+        if (line.compare(0, 5, "some ") != 0) {
+            continue;
+        }
+        size_t pos = line.find("total=");
+        if (pos == std::string::npos) {
+            return false;
+        }
+        totalUs = std::strtoull(line.c_str() + pos + 6, nullptr, 10);
+        return true;
+    }
+    return false;
+}
+
+// "0.56 1.36 1.79 2/72 15308", the fourth field is runnable/total
+bool CpuPressure::ReadRunnable(uint32_t& runnable)
+{
+    std::ifstream loadFile(LOADAVG_PATH);
+    std::string load1;
+    std::string load5;
+    std::string load15;
+    std::string tasks;
+    if (!(loadFile >> load1 >> load5 >> load15 >> tasks)) {
+        return false;
+    }
+    runnable = static_cast<uint32_t>(std::strtoul(tasks.c_str(), nullptr, 10));
+    return true;
+}
+
+bool CpuPressure::Sample(CpuPressureSample& sample)
+{
+    uint64_t totalUs = 0;
+    if (psiPath.empty() || !ReadStallTotal(psiPath, totalUs)) {
+        return false;
+    }
+    auto now = std::chrono::steady_clock::now();
+    bool hasBaseline = lastTime != std::chrono::steady_clock::time_point {};
+    uint64_t periodUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - lastTime).count());
+    uint64_t stallUs = totalUs >= lastTotalUs ? totalUs - lastTotalUs : 0;
+    lastTotalUs = totalUs;
+    lastTime = now;
+    if (!hasBaseline || periodUs == 0) {
+        return false;
+    }
+
+    sample.stallPct = static_cast<uint32_t>(std::min(stallUs * PERCENT / periodUs, PERCENT));
+    if (!ReadRunnable(sample.runnable)) {
+        sample.runnable = 0;
+    }
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    sample.cpus = cpus > 0 ? static_cast<uint32_t>(cpus) : 1;
+    return true;
+}
+} // namespace ffrt
@@ -35,6 +35,8 @@ namespace {
 const unsigned int TRY_POLL_FREQ = 51;
 const unsigned int LOCAL_QUEUE_SIZE = 128;
 const unsigned int STEAL_BUFFER_SIZE = LOCAL_QUEUE_SIZE / 2;
+// successive next tasks run by a worker before it takes one from the global queue
+const unsigned int NEXT_TASK_RUN_LIMIT = 16;
 }
 
 namespace ffrt {
@@ -202,7 +204,7 @@ void CPUWorker::Dispatch(CPUWorker* worker)
 
 bool CPUWorker::RunSingleTask(int qos, CPUWorker *worker)
 {
-    TaskBase *task = FFRTFacade::GetScheduler().PopTask(qos);
+    TaskBase *task = FFRTFacade::GetScheduler().StealTask(qos);
     if (task) {
         RunTask(task, worker);
         return true;
@@ -210,15 +212,40 @@ bool CPUWorker::RunSingleTask(int qos, CPUWorker *worker)
     return false;
 }
 
+void CPUWorker::PushNextTask(ExecuteCtx* ctx)
+{
+    TaskBase* task = ctx->nextTask;
+    ctx->nextTask = nullptr;
+    bool isRisingEdge = schedIns.PushTask(task, false);
+    euIns.NotifyTask<TaskNotifyType::TASK_ADDED_RTQ>(qos, false, isRisingEdge);
+}
+
 void CPUWorker::WorkerLooper()
 {
+    ExecuteCtx* ctx = ExecuteCtx::Cur();
+    unsigned int nextTaskRuns = 0;
     for (;;) {
         if (Exited()) {
             break;
         }
 
+        if (ctx->nextTask != nullptr) {
+            if (nextTaskRuns < NEXT_TASK_RUN_LIMIT && schedIns.GetScheduler(qos).CanRunNext(ctx->nextTask)) {
+                TaskBase* task = ctx->nextTask;
+                ctx->nextTask = nullptr;
+                nextTaskRuns++;
+                task->Pop();
+                RunTask(task, this);
+                continue;
+            }
+            // a chain of successors must not starve the tasks waiting in the global queue,
+            // nor pass a task the queue got to run first since the slot was filled
+            PushNextTask(ctx);
+        }
+
         TaskBase* task = schedIns.PopTask(qos);
         if (task) {
+            nextTaskRuns = 0;
             euIns.NotifyTask<TaskNotifyType::TASK_PICKED>(qos);
             RunTask(task, this);
             continue;
@@ -237,5 +264,8 @@ void CPUWorker::WorkerLooper()
             break;
         }
     }
+    if (ctx->nextTask != nullptr) {
+        PushNextTask(ctx);
+    }
 }
 } // namespace ffrt
@@ -16,6 +16,8 @@
 #include "eu/execute_unit.h"
 
 #include <sys/resource.h>
+#include <algorithm>
+#include <thread>
 #include "internal_inc/config.h"
 #include "util/singleton_register.h"
 #include "eu/co_routine_factory.h"
@@ -27,6 +29,10 @@ namespace {
 const size_t MAX_ESCAPE_WORKER_NUM = 1024;
 constexpr uint64_t MAX_ESCAPE_INTERVAL_MS_COUNT = 1000ULL * 100 * 60 * 60 * 24 * 365; // 100 year
 constexpr size_t MAX_TID_SIZE = 100;
+constexpr uint64_t MIN_PRESSURE_INTERVAL_MS = 10;
+constexpr uint32_t MAX_STALL_THRESHOLD_PCT = 100;
+constexpr size_t PRESSURE_SCALING_STEP = 4; // the limit moves by a quarter per period
+constexpr uint64_t DELAYED_CB_WAIT_UNIT_US = 100;
 ffrt::WorkerStatusInfo g_workerStatusInfo[ffrt::QoS::MaxNum()];
 ffrt::fast_mutex g_workerStatusMutex[ffrt::QoS::MaxNum()];
 
@@ -85,6 +91,8 @@ ExecuteUnit::ExecuteUnit()
         we_[idx] = new WaitUntilEntry;
         we_[idx]->cb = nullptr;
     }
+    pressureWe = new WaitUntilEntry;
+    pressureWe->cb = nullptr;
 
     if (strstr(GetCurrentProcessName(), "CameraDaemon")) {
         SetWorkerShare(WORKER_SHARE_CONFIG);
@@ -99,12 +107,35 @@ ExecuteUnit::~ExecuteUnit()
 {
     // worker escape event
     FFRT_LOGI("Destructor.");
+    // the delayedWorker outlives this unit, so its pending entries must be gone before they are freed
+    {
+        std::lock_guard lk(pressureMutex);
+        if (pressureTickPending && DelayedRemove(pressureWe->tp, pressureWe)) {
+            pressureTickPending = false;
+        }
+    }
+    for (int idx = 0; idx < QoS::MaxNum(); idx++) {
+        if (submittedDelayedTask_[idx] && DelayedRemove(we_[idx]->tp, we_[idx])) {
+            submittedDelayedTask_[idx].store(false, std::memory_order_relaxed);
+        }
+    }
+    // wait for the callbacks already taken by the delayedWorker
+    auto delayedCbRunning = [this]() {
+        std::lock_guard lk(pressureMutex);
+        return pressureTickPending || std::any_of(std::begin(submittedDelayedTask_), std::end(submittedDelayedTask_),
+            [](const std::atomic<bool>& submitted) { return submitted.load(); });
+    };
+    while (!GetDelayedWorkerExitFlag() && delayedCbRunning()) {
+        std::this_thread::sleep_for(std::chrono::microseconds(DELAYED_CB_WAIT_UNIT_US));
+    }
     for (int idx = 0; idx < QoS::MaxNum(); idx++) {
         if (we_[idx] != nullptr) {
             delete we_[idx];
             we_[idx] = nullptr;
         }
     }
+    delete pressureWe;
+    pressureWe = nullptr;
     tearDownFinish = true;
 }
 
@@ -280,6 +311,158 @@ void ExecuteUnit::SubmitEscape(int qos, uint64_t totalWorkerNum)
     submittedDelayedTask_[qos].store(true, std::memory_order_relaxed);
 }
 
+int ExecuteUnit::SetPressureScalingEnable(uint64_t intervalMs, uint32_t stallThresholdPct)
+{
+    std::lock_guard lk(pressureMutex);
+    if (pressureConfig.enable_) {
+        FFRT_LOGW("Worker pressure scaling is enabled, the interface cannot be invoked repeatedly.");
+        return 1;
+    }
+
+    if (intervalMs < MIN_PRESSURE_INTERVAL_MS || stallThresholdPct == 0 ||
+        stallThresholdPct > MAX_STALL_THRESHOLD_PCT) {
+        FFRT_LOGE("Setting failed, interval ms [%llu] cannot be smaller than [%llu], "
+                  "and stall threshold [%u] must be in (0, %u].",
+            intervalMs, MIN_PRESSURE_INTERVAL_MS, stallThresholdPct, MAX_STALL_THRESHOLD_PCT);
+        return 1;
+    }
+    ClampValue(intervalMs, MAX_ESCAPE_INTERVAL_MS_COUNT);
+
+    if (cpuPressure == nullptr) {
+        cpuPressure = std::make_unique<CpuPressure>();
+    }
+    if (!cpuPressure->Available()) {
+        return 1;
+    }
+    // sets the baseline of the first period
+    CpuPressureSample sample;
+    cpuPressure->Sample(sample);
+
+    for (auto qos = QoS::Min(); qos < QoS::Max(); ++qos) {
+        std::lock_guard lg(workerGroup[qos].lock);
+        baseConcurrency[qos] = workerGroup[qos].maxConcurrency;
+        scaledConcurrency[qos] = workerGroup[qos].maxConcurrency;
+    }
+    pressureConfig.intervalMs_ = intervalMs;
+    pressureConfig.stallThresholdPct_ = stallThresholdPct;
+    if (!pressureTickPending && !SubmitPressureTick()) {
+        return 1;
+    }
+    pressureConfig.enable_ = true;
+    FFRT_LOGI("Enable worker pressure scaling success, interval ms %llu, stall threshold %u%%.",
+        intervalMs, stallThresholdPct);
+    return 0;
+}
+
+void ExecuteUnit::SetPressureScalingDisable()
+{
+    std::lock_guard lk(pressureMutex);
+    if (!pressureConfig.enable_) {
+        return;
+    }
+    pressureConfig.enable_ = false;
+    // the pending period sees the function disabled and stops
+    RestoreConcurrency();
+}
+
+void ExecuteUnit::RestoreConcurrency()
+{
+    for (auto qos = QoS::Min(); qos < QoS::Max(); ++qos) {
+        {
+            std::lock_guard lg(workerGroup[qos].lock);
+            if (workerGroup[qos].maxConcurrency == scaledConcurrency[qos]) {
+                workerGroup[qos].maxConcurrency = baseConcurrency[qos];
+            }
+        }
+        if (FFRTFacade::GetScheduler().GetGlobalTaskCnt(qos) > 0) {
+            NotifyTask<TaskNotifyType::TASK_ADDED>(qos);
+        }
+    }
+}
+
+bool ExecuteUnit::SubmitPressureTick()
+{
+    pressureWe->tp = std::chrono::steady_clock::now() + std::chrono::milliseconds(pressureConfig.intervalMs_);
+    if (pressureWe->cb == nullptr) {
+        pressureWe->cb = [this](WaitEntry *we) {
+            (void)we;
+            PressureTick();
+        };
+    }
+
+    if (!DelayedWakeup(pressureWe->tp, pressureWe, pressureWe->cb, true)) {
+        FFRT_LOGW("Failed to set pressure scaling task.");
+        return false;
+    }
+    pressureTickPending = true;
+    return true;
+}
+
+void ExecuteUnit::PressureTick()
+{
+    std::lock_guard lk(pressureMutex);
+    pressureTickPending = false;
+    if (!pressureConfig.enable_ || tearDown) {
+        return;
+    }
+
+    CpuPressureSample sample;
+    if (cpuPressure->Sample(sample)) {
+        AdjustConcurrencyByPressure(sample);
+    }
+    if (!SubmitPressureTick()) {
+        pressureConfig.enable_ = false;
+        RestoreConcurrency();
+    }
+}
+
+void ExecuteUnit::AdjustConcurrencyByPressure(const CpuPressureSample& sample)
+{
+    /*
+     * Extra workers only add context switches once the cgroup stalls on the cpu while the runnable tasks of the
+     * system outnumber the cpus.
+     */
+    bool overloaded = sample.stallPct >= pressureConfig.stallThresholdPct_ && sample.runnable > sample.cpus;
+    bool relieved = sample.stallPct < pressureConfig.stallThresholdPct_ / 2;
+    if (!overloaded && !relieved) {
+        return;
+    }
+
+    for (auto qos = QoS::Min(); qos < QoS::Max(); ++qos) {
+        CPUWorkerGroup &group = workerGroup[qos];
+        bool raised = false;
+        {
+            std::lock_guard lg(group.lock);
+            size_t cur = group.maxConcurrency;
+            // a limit set by the user while scaling is on becomes the one to restore
+            if (cur != scaledConcurrency[qos]) {
+                baseConcurrency[qos] = cur;
+            }
+            size_t base = baseConcurrency[qos];
+            if (overloaded) {
+                size_t floor = std::max<size_t>(1, std::min(base, static_cast<size_t>(DEFAULT_MINCONCURRENCY)));
+                // a limit far above the workers in use would take many periods to bite
+                cur = std::min(cur, std::max(static_cast<size_t>(group.executingNum), floor));
+                size_t step = std::max<size_t>(1, cur / PRESSURE_SCALING_STEP);
+                cur = std::max(floor, cur > step ? cur - step : 1);
+            } else if (cur < base) {
+                size_t next = cur + std::max<size_t>(1, cur / PRESSURE_SCALING_STEP);
+                cur = (next >= std::min(base, group.hardLimit)) ? base : next;
+                raised = true;
+            }
+            if (cur != group.maxConcurrency) {
+                FFRT_LOGD("qos[%d] max concurrency %zu -> %zu, stall %u%%, runnable %u, cpus %u",
+                    static_cast<int>(qos), group.maxConcurrency, cur, sample.stallPct, sample.runnable, sample.cpus);
+            }
+            group.maxConcurrency = cur;
+            scaledConcurrency[qos] = cur;
+        }
+        if (raised && FFRTFacade::GetScheduler().GetGlobalTaskCnt(qos) > 0) {
+            NotifyTask<TaskNotifyType::TASK_ADDED>(qos);
+        }
+    }
+}
+
 std::array<std::atomic<sched_mode_type>, QoS::MaxNum()> ExecuteUnit::schedMode{};
 
 bool ExecuteUnit::IncWorker(const QoS &qos)
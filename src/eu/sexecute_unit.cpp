@@ -113,7 +113,11 @@ SExecuteUnit::~SExecuteUnit()
     // alive when that happens. Hence, we
     // delay the destruction till we ensure
     // this access cannot happen.
-    FFRTFacade::GetDelayedWorker().Terminate();
+    // The delayedWorker only calls the unit of the facade,
+    // any other unit must leave the shared worker running.
+    if (gExecuteUnit == this) {
+        FFRTFacade::GetDelayedWorker().Terminate();
+    }
     FFRT_LOGD("Destruction completed.");
 }
 
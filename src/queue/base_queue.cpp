@@ -186,19 +186,31 @@ std::vector<QueueTask*> BaseQueue::GetHeadTask()
     return headTaskVec_;
 }
 
-void BaseQueue::GetWhenMapVecStats(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec)
+void BaseQueue::UpdateWhenMapVecStats(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec, int idx)
 {
-    minTime_ = std::numeric_limits<uint64_t>::max();
+    const auto& whenMap = whenMapVec[idx];
+    mapSize_.fetch_add(whenMap.size() - mapSizeVec_[idx]);
+    mapSizeVec_[idx] = whenMap.size();
+    if (whenMap.empty()) {
+        readyBitmap_ &= ~(1u << idx);
+    } else {
+        readyBitmap_ |= (1u << idx);
+        headTimeVec_[idx] = whenMap.begin()->first;
+    }
 
-    for (int idx = 0; idx <= ffrt_queue_priority_idle; idx++) {
-        if (!whenMapVec[idx].empty()) {
-            auto it = whenMapVec[idx].begin();
-            if (it->first < minTime_) {
-                minTime_ = it->first;
-            }
-        }
+    // only the cached head times of non-empty priorities are compared, the maps are not traversed
+    uint64_t minTime = std::numeric_limits<uint64_t>::max();
+    for (uint32_t bits = readyBitmap_; bits != 0; bits &= bits - 1) {
+        minTime = std::min(minTime, headTimeVec_[__builtin_ctz(bits)]);
     }
+    minTime_.store(minTime);
+    isEmpty_ = (readyBitmap_ == 0);
+}
 
-    isEmpty_ = (minTime_ == std::numeric_limits<uint64_t>::max());
+void BaseQueue::UpdateWhenMapVecStats(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec, int begin, int end)
+{
+    for (int idx = begin; idx <= end; idx++) {
+        UpdateWhenMapVecStats(whenMapVec, idx);
+    }
 }
 } // namespace ffrt
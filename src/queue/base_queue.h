@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -99,15 +100,22 @@ protected:
     int Remove(const char* name, std::multimap<uint64_t, QueueTask*>& whenMap);
     bool HasTask(const char* name, std::multimap<uint64_t, QueueTask*> whenMap);
     uint64_t GetDueTaskCount(std::multimap<uint64_t, QueueTask*>& whenMap);
-    void GetWhenMapVecStats(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec);
+    void UpdateWhenMapVecStats(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec, int idx);
+    void UpdateWhenMapVecStats(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec, int begin, int end);
 
     const uint32_t queueId_;
     std::atomic_bool delayStatus_ { false };
     bool isExit_ { false };
     std::atomic_bool isActiveState_ { false };
     std::multimap<uint64_t, QueueTask*> whenMap_;
-    bool isEmpty_;
-    uint64_t minTime_;
+    bool isEmpty_ { true };
+    std::atomic_uint64_t minTime_ { std::numeric_limits<uint64_t>::max() };
+
+    // per-priority stats of whenMapVec, updated under mutex_ whenever a priority map changes
+    uint32_t readyBitmap_ { 0 }; // bit idx is set when whenMapVec[idx] is not empty
+    uint64_t headTimeVec_[ffrt_inner_queue_priority_idle + 1] {};
+    uint64_t mapSizeVec_[ffrt_inner_queue_priority_idle + 1] {};
+    std::atomic_uint64_t mapSize_ { 0 };
     std::vector<QueueTask*> headTaskVec_;
     QueueStrategy<QueueTask>::DequeFunc dequeFunc_ { nullptr };
 
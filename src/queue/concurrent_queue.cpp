@@ -20,20 +20,6 @@
 #include "eu/loop.h"
 #include "util/ffrt_facade.h"
 
-namespace {
-
-// Kept for GetHeadTask() which is not a hot path - single traversal only
-bool WhenMapVecEmpty(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec)
-{
-    for (int idx = 0; idx <= ffrt_queue_priority_idle; idx++) {
-        if (!whenMapVec[idx].empty()) {
-            return false;
-        }
-    }
-    return true;
-}
-}
-
 namespace ffrt {
 static void DelayTaskCb(void* task)
 {
@@ -57,12 +43,14 @@ int ConcurrentQueue::Push(QueueTask* task)
 
     if (waitingAll_) {
         waitingMap_.insert({task->GetUptime(), task});
+        waitingMapSize_.store(waitingMap_.size());
         return SUCC;
     }
 
     if (loop_ != nullptr) {
         if (task->GetDelay() == 0) {
             whenMapVec_[taskPriority].insert({task->GetUptime(), task});
+            UpdateWhenMapVecStats(whenMapVec_, taskPriority);
             loop_->WakeUp();
             return SUCC;
         }
@@ -77,10 +65,9 @@ QueueTask* ConcurrentQueue::Pull()
     std::unique_lock lock(mutex_);
     // wait for delay task
     uint64_t now = GetNow();
-    GetWhenMapVecStats(whenMapVec_);
     if (loop_ != nullptr) {
         if (!isEmpty_ && now >= minTime_ && !isExit_) {
-            return dequeFunc_(queueId_, now, whenMapVec_, nullptr);
+            return DequeTask(now);
         }
         return nullptr;
     }
@@ -93,8 +80,6 @@ QueueTask* ConcurrentQueue::Pull()
         delayStatus_.store(false);
         FFRT_LOGD("[queueId=%u] wakeup from wait", queueId_);
         now = GetNow();
-        // OPT: single traversal instead of two separate calls
-        GetWhenMapVecStats(whenMapVec_);
     }
 
     // abort dequeue in abnormal scenarios
@@ -109,7 +94,14 @@ QueueTask* ConcurrentQueue::Pull()
     FFRT_COND_DO_ERR(isExit_, return nullptr, "cannot pull task, [queueId=%u] is exiting", queueId_);
 
     // dequeue next expired task by priority
-    return dequeFunc_(queueId_, now, whenMapVec_, nullptr);
+    return DequeTask(now);
+}
+
+QueueTask* ConcurrentQueue::DequeTask(uint64_t now)
+{
+    QueueTask* task = dequeFunc_(queueId_, now, whenMapVec_, readyBitmap_, nullptr);
+    UpdateWhenMapVecStats(whenMapVec_, task->GetPriority());
+    return task;
 }
 
 int ConcurrentQueue::Remove()
@@ -119,7 +111,10 @@ int ConcurrentQueue::Remove()
     for (auto& currentMap : whenMapVec_) {
         removeCount += BaseQueue::Remove(currentMap);
     }
-    return removeCount + BaseQueue::Remove(waitingMap_);
+    removeCount += BaseQueue::Remove(waitingMap_);
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_queue_priority_immediate, ffrt_queue_priority_idle);
+    waitingMapSize_.store(waitingMap_.size());
+    return removeCount;
 }
 
 int ConcurrentQueue::Remove(const char* name)
@@ -129,18 +124,24 @@ int ConcurrentQueue::Remove(const char* name)
     for (auto& currentMap : whenMapVec_) {
         removeCount += BaseQueue::Remove(name, currentMap);
     }
-    return removeCount + BaseQueue::Remove(name, waitingMap_);
+    removeCount += BaseQueue::Remove(name, waitingMap_);
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_queue_priority_immediate, ffrt_queue_priority_idle);
+    waitingMapSize_.store(waitingMap_.size());
+    return removeCount;
 }
 
 int ConcurrentQueue::Remove(const QueueTask* task)
 {
     std::lock_guard lock(mutex_);
-    for (auto& currentMap : whenMapVec_) {
-        if (BaseQueue::Remove(task, currentMap) == SUCC) {
+    for (int idx = ffrt_queue_priority_immediate; idx <= ffrt_queue_priority_idle; idx++) {
+        if (BaseQueue::Remove(task, whenMapVec_[idx]) == SUCC) {
+            UpdateWhenMapVecStats(whenMapVec_, idx);
             return SUCC;
         }
     }
-    return BaseQueue::Remove(task, waitingMap_);
+    int ret = BaseQueue::Remove(task, waitingMap_);
+    waitingMapSize_.store(waitingMap_.size());
+    return ret;
 }
 
 void ConcurrentQueue::Stop()
@@ -152,6 +153,8 @@ void ConcurrentQueue::Stop()
         Stop(whenMapVec_[idx]);
     }
     Stop(waitingMap_);
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_queue_priority_immediate, ffrt_queue_priority_idle);
+    waitingMapSize_.store(0);
 
     if (loop_ == nullptr) {
         cond_.notify_all();
@@ -193,6 +196,7 @@ int ConcurrentQueue::WaitAll()
     }
     waitingAll_ = false;
     waitingMap_.clear();
+    waitingMapSize_.store(0);
     return 0;
 }
 
@@ -228,12 +232,14 @@ int ConcurrentQueue::PushAndCalConcurrency(QueueTask* task, ffrt_queue_priority_
 
         if (task->GetDelay() > 0) {
             whenMapVec_[taskPriority].insert({task->GetUptime(), task});
+            UpdateWhenMapVecStats(whenMapVec_, taskPriority);
         }
 
         return CONCURRENT;
     }
 
     whenMapVec_[taskPriority].insert({task->GetUptime(), task});
+    UpdateWhenMapVecStats(whenMapVec_, taskPriority);
     if (task == whenMapVec_[taskPriority].begin()->second) {
         if (needUnlock) {
             lock.unlock();
@@ -275,7 +281,7 @@ bool ConcurrentQueue::HasTask(const char* name)
 std::vector<QueueTask*> ConcurrentQueue::GetHeadTask()
 {
     std::lock_guard lock(mutex_);
-    if (WhenMapVecEmpty(whenMapVec_)) {
+    if (readyBitmap_ == 0) {
         return {};
     }
 
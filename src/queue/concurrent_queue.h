@@ -15,7 +15,6 @@
 #ifndef FFRT_CONCURRENT_QUEUE_H
 #define FFRT_CONCURRENT_QUEUE_H
 
-#include <numeric>
 #include "queue/base_queue.h"
 
 namespace ffrt {
@@ -50,10 +49,7 @@ public:
 
     uint64_t GetMapSize() override
     {
-        std::lock_guard lock(mutex_);
-        return std::accumulate(std::begin(whenMapVec_), std::end(whenMapVec_), 0u,
-            [] (uint64_t size, const std::multimap<uint64_t, QueueTask*>& whenMap) { return size + whenMap.size(); })
-            + waitingMap_.size();
+        return mapSize_.load() + waitingMapSize_.load();
     }
 
     bool SetLoop(Loop* loop);
@@ -75,6 +71,7 @@ public:
     }
 
 private:
+    QueueTask* DequeTask(uint64_t now);
     int PushDelayTaskToTimer(QueueTask* task);
     int PushAndCalConcurrency(QueueTask* task, ffrt_queue_priority_t taskPriority, std::unique_lock<ffrt::mutex>& lock,
         bool needUnlock);
@@ -89,6 +86,7 @@ private:
 
     bool waitingAll_ = false;
     std::multimap<uint64_t, QueueTask*> waitingMap_;
+    std::atomic_uint64_t waitingMapSize_ {0};
     std::multimap<uint64_t, QueueTask*> whenMapVec_[ffrt_queue_priority_idle + 1];
     std::vector<std::pair<uint64_t, QueueTask*>> allWhenmapTask_;
 };
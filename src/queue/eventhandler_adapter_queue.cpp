@@ -22,9 +22,19 @@
 
 namespace {
 constexpr int MAX_DUMP_SIZE = 500;
-constexpr uint8_t HISTORY_TASK_NUM_POWER = 32;
 
-void DumpRunningTaskInfo(const char* tag, const ffrt::HistoryTask& currentRunningTask, std::ostringstream& oss)
+// same format as the label of queue task: queueName[_taskName]_gid
+std::string GetHistoryTaskName(const std::string& queueName, const ffrt::HistoryTask& task)
+{
+    std::string taskName = queueName;
+    if (task.taskName_ != nullptr) {
+        taskName += "_" + task.taskName_->Str();
+    }
+    return taskName + "_" + std::to_string(task.gid_);
+}
+
+void DumpRunningTaskInfo(const char* tag, const std::string& queueName, const ffrt::HistoryTask& currentRunningTask,
+    std::ostringstream& oss)
 {
     oss << tag << " Current Running: ";
     if (currentRunningTask.beginTime_ == std::numeric_limits<uint64_t>::max()) {
@@ -35,28 +45,30 @@ void DumpRunningTaskInfo(const char* tag, const ffrt::HistoryTask& currentRunnin
         oss << "send thread = " << currentRunningTask.senderKernelThreadId_;
         oss << ", send time = " << ffrt::FormatDateString4SteadyClock(currentRunningTask.sendTime_);
         oss << ", handle time = " << ffrt::FormatDateString4SteadyClock(currentRunningTask.handleTime_);
-        oss << ", task name = " << currentRunningTask.taskName_;
+        oss << ", task name = " << GetHistoryTaskName(queueName, currentRunningTask);
         oss << " }\n";
     }
 }
 
-void DumpHistoryTaskInfo(const char* tag, const std::vector<ffrt::HistoryTask>& historyTasks, std::ostringstream& oss)
+void DumpHistoryTaskInfo(const char* tag, const std::string& queueName, const ffrt::HistoryTaskSlot* historyTasks,
+    uint8_t historyTaskNum, std::ostringstream& oss)
 {
     oss << tag << " History event queue information:\n";
-    for (uint8_t i = 0; i < HISTORY_TASK_NUM_POWER; i++) {
-        auto historyTask = historyTasks[i];
-        if (historyTask.senderKernelThreadId_ == 0) {
-            continue;
-        }
+    for (uint8_t i = 0; i < historyTaskNum; i++) {
+        historyTasks[i].Load([&](const ffrt::HistoryTask& historyTask) {
+            if (historyTask.senderKernelThreadId_ == 0) {
+                return;
+            }
 
-        oss << tag << " No. " << (i + 1) << " : Event { ";
-        oss << "send thread = " << historyTask.senderKernelThreadId_;
-        oss << ", send time = " << ffrt::FormatDateString4SteadyClock(historyTask.sendTime_);
-        oss << ", handle time = " << ffrt::FormatDateString4SteadyClock(historyTask.handleTime_);
-        oss << ", trigger time = " << ffrt::FormatDateString4SteadyClock(historyTask.triggerTime_);
-        oss << ", complete time = " << ffrt::FormatDateString4SteadyClock(historyTask.completeTime_);
-        oss << ", task name = " << historyTask.taskName_;
-        oss << " }\n";
+            oss << tag << " No. " << (i + 1) << " : Event { ";
+            oss << "send thread = " << historyTask.senderKernelThreadId_;
+            oss << ", send time = " << ffrt::FormatDateString4SteadyClock(historyTask.sendTime_);
+            oss << ", handle time = " << ffrt::FormatDateString4SteadyClock(historyTask.handleTime_);
+            oss << ", trigger time = " << ffrt::FormatDateString4SteadyClock(historyTask.triggerTime_);
+            oss << ", complete time = " << ffrt::FormatDateString4SteadyClock(historyTask.completeTime_);
+            oss << ", task name = " << GetHistoryTaskName(queueName, historyTask);
+            oss << " }\n";
+        });
     }
 }
 
@@ -103,23 +115,12 @@ void DumpUnexecutedTaskInfo(const char* tag,
     }
     oss << tag << " Total event size : " << total << "\n";
 }
-
-bool WhenMapVecEmpty(const std::multimap<uint64_t, ffrt::QueueTask*>* whenMapVec)
-{
-    for (int idx = 0; idx <= ffrt_inner_queue_priority_idle; idx++) {
-        if (!whenMapVec[idx].empty()) {
-            return false;
-        }
-    }
-    return true;
-}
 }
 
 namespace ffrt {
 EventHandlerAdapterQueue::EventHandlerAdapterQueue(const char* name) : EventHandlerInteractiveQueue(name)
 {
     dequeFunc_ = QueueStrategy<QueueTask>::DequeSingleAgainstStarvation;
-    historyTasks_ = std::vector<HistoryTask>(HISTORY_TASK_NUM_POWER);
     pulledTaskCount_ = std::vector<int>(ffrt_inner_queue_priority_idle + 1, 0);
 }
 
@@ -134,6 +135,7 @@ void EventHandlerAdapterQueue::Stop()
     for (auto& currentMap : whenMapVec_) {
         BaseQueue::Stop(currentMap);
     }
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_inner_queue_priority_vip, ffrt_inner_queue_priority_idle);
     FFRT_LOGI("clear [queueId=%u] succ", queueId_);
 }
 
@@ -156,6 +158,7 @@ int EventHandlerAdapterQueue::Push(QueueTask* task)
     } else {
         whenMapVec_[taskPriority].insert({task->GetUptime(), task});
     }
+    UpdateWhenMapVecStats(whenMapVec_, taskPriority);
     if (task == whenMapVec_[taskPriority].begin()->second) {
         cond_.notify_one();
     }
@@ -168,7 +171,6 @@ QueueTask* EventHandlerAdapterQueue::Pull()
     std::unique_lock lock(mutex_);
     // wait for delay task
     uint64_t now = GetNow();
-    GetWhenMapVecStats(whenMapVec_);
     while (!isEmpty_ && now < minTime_ && !isExit_) {
         uint64_t diff = minTime_ - now;
         FFRT_LOGD("[queueId=%u] stuck in %llu us wait", queueId_, diff);
@@ -177,7 +179,6 @@ QueueTask* EventHandlerAdapterQueue::Pull()
         delayStatus_.store(false);
         FFRT_LOGD("[queueId=%u] wakeup from wait", queueId_);
         now = GetNow();
-        GetWhenMapVecStats(whenMapVec_);
     }
 
     // abort dequeue in abnormal scenarios
@@ -189,7 +190,9 @@ QueueTask* EventHandlerAdapterQueue::Pull()
     FFRT_COND_DO_ERR(isExit_, return nullptr, "cannot pull task, [queueId=%u] is exiting", queueId_);
 
     // dequeue due tasks in batch
-    return dequeFunc_(queueId_, now, whenMapVec_, &pulledTaskCount_);
+    QueueTask* task = dequeFunc_(queueId_, now, whenMapVec_, readyBitmap_, &pulledTaskCount_);
+    UpdateWhenMapVecStats(whenMapVec_, task->GetPriority());
+    return task;
 }
 
 int EventHandlerAdapterQueue::Remove()
@@ -199,6 +202,7 @@ int EventHandlerAdapterQueue::Remove()
     for (auto& currentMap : whenMapVec_) {
         count += BaseQueue::Remove(currentMap);
     }
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_inner_queue_priority_vip, ffrt_inner_queue_priority_idle);
     return count;
 }
 
@@ -209,6 +213,7 @@ int EventHandlerAdapterQueue::Remove(const char* name)
     for (auto& currentMap : whenMapVec_) {
         count += BaseQueue::Remove(name, currentMap);
     }
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_inner_queue_priority_vip, ffrt_inner_queue_priority_idle);
     return count;
 }
 
@@ -219,6 +224,7 @@ int EventHandlerAdapterQueue::Remove(const QueueTask* task)
     for (auto& currentMap : whenMapVec_) {
         count += BaseQueue::Remove(task, currentMap);
     }
+    UpdateWhenMapVecStats(whenMapVec_, ffrt_inner_queue_priority_vip, ffrt_inner_queue_priority_idle);
     return count;
 }
 
@@ -236,17 +242,16 @@ bool EventHandlerAdapterQueue::HasTask(const char* name)
 bool EventHandlerAdapterQueue::IsIdle()
 {
     std::lock_guard lock(mutex_);
-
-    for (int idx = 0; idx <= ffrt_queue_priority_idle; idx++) {
-        if (!whenMapVec_[idx].empty()) {
-            return false;
-        }
-    }
-    return true;
+    return readyBitmap_ == 0;
 }
 
 uint64_t EventHandlerAdapterQueue::GetDueTaskCount()
 {
+    // no task is due before the cached earliest uptime, which is the common case when polled
+    if (mapSize_.load() == 0 || minTime_.load() > GetNow()) {
+        return 0;
+    }
+
     std::lock_guard lock(mutex_);
     uint64_t count = 0;
     for (auto& currentMap : whenMapVec_) {
@@ -263,8 +268,8 @@ int EventHandlerAdapterQueue::Dump(const char* tag, char* buf, uint32_t len, boo
     std::lock_guard lock(mutex_);
     std::ostringstream oss;
     if (historyInfo) {
-        DumpRunningTaskInfo(tag, currentRunningTask_, oss);
-        DumpHistoryTaskInfo(tag, historyTasks_, oss);
+        currentRunningTask_.Load([&](const HistoryTask& task) { DumpRunningTaskInfo(tag, name_, task, oss); });
+        DumpHistoryTaskInfo(tag, name_, historyTasks_, HISTORY_TASK_NUM_POWER, oss);
     }
     DumpUnexecutedTaskInfo(tag, whenMapVec_, oss);
     return snprintf_s(buf, len, len - 1, "%s", oss.str().c_str());
@@ -278,19 +283,20 @@ int EventHandlerAdapterQueue::DumpSize(ffrt_inner_queue_priority_t priority)
 
 void EventHandlerAdapterQueue::SetCurrentRunningTask(QueueTask* task)
 {
-    currentRunningTask_ = HistoryTask(GetNow(), task);
+    currentRunningTask_.Store(HistoryTask(GetNow(), task));
 }
 
 void EventHandlerAdapterQueue::PushHistoryTask(QueueTask* task, uint64_t triggerTime, uint64_t completeTime)
 {
     HistoryTask historyTask;
     historyTask.senderKernelThreadId_ = task->fromTid;
-    historyTask.taskName_ = task->label;
+    historyTask.taskName_ = task->GetHistoryName();
+    historyTask.gid_ = task->gid;
     historyTask.sendTime_ = task->GetUptime() - task->GetDelay();
     historyTask.handleTime_ = task->GetUptime();
     historyTask.triggerTime_ = triggerTime;
     historyTask.completeTime_ = completeTime;
-    historyTasks_[historyTaskIndex_.fetch_add(1) & (HISTORY_TASK_NUM_POWER - 1)] = historyTask;
+    historyTasks_[historyTaskIndex_.fetch_add(1) & (HISTORY_TASK_NUM_POWER - 1)].Store(historyTask);
 }
 
 std::unique_ptr<BaseQueue> CreateEventHandlerAdapterQueue(const ffrt_queue_attr_t* attr, const char* name)
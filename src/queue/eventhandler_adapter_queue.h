@@ -16,15 +16,16 @@
 #define FFRT_EVENTHANDLER_ADAPTER_QUEUE_H
 
 #include <vector>
-#include <numeric>
 #include "tm/queue_task.h"
 #include "queue/base_queue.h"
 #include "eventhandler_interactive_queue.h"
 
 namespace ffrt {
+// the task name is shared with the task, it is created once per task and no record copies it
 struct HistoryTask {
     int32_t senderKernelThreadId_{0};
-    std::string taskName_{0};
+    HistoryTaskName* taskName_{nullptr}; // nullptr if the task was submitted without a name
+    uint64_t gid_{0};
     uint64_t sendTime_{0};
     uint64_t handleTime_{0};
     uint64_t beginTime_{0};
@@ -40,12 +41,75 @@ struct HistoryTask {
     {
         beginTime_ = beginTime;
         senderKernelThreadId_ = task->fromTid;
+        taskName_ = task->GetHistoryName();
+        gid_ = task->gid;
         sendTime_ = task->GetUptime() - task->GetDelay();
-        taskName_ = task->label;
         handleTime_ = task->GetUptime();
     }
 };
 
+// one slot of the history ring, written without allocating or taking a lock.
+// The ring index is taken with fetch_add, so a lagging writer may share a slot with one that wrapped around:
+// writers and readers claim the slot for the few words they copy by moving the counter from even to odd.
+// The slot holds a reference to the name it records, which keeps the name alive after its task is freed.
+class HistoryTaskSlot {
+public:
+    HistoryTaskSlot() = default;
+
+    ~HistoryTaskSlot()
+    {
+        if (task_.taskName_ != nullptr) {
+            task_.taskName_->DecRef();
+        }
+    }
+
+    HistoryTaskSlot(const HistoryTaskSlot&) = delete;
+    HistoryTaskSlot& operator=(const HistoryTaskSlot&) = delete;
+
+    void Store(const HistoryTask& task)
+    {
+        if (task.taskName_ != nullptr) {
+            task.taskName_->IncRef();
+        }
+        uint32_t seq = Claim();
+        HistoryTaskName* replaced = task_.taskName_;
+        task_ = task;
+        seq_.store(seq + 2, std::memory_order_release);
+        if (replaced != nullptr) {
+            replaced->DecRef();
+        }
+    }
+
+    // reader gets a copy of the record, whose name stays valid until reader returns
+    template <typename Reader>
+    void Load(Reader&& reader) const
+    {
+        uint32_t seq = Claim();
+        HistoryTask task = task_;
+        if (task.taskName_ != nullptr) {
+            task.taskName_->IncRef();
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+        reader(static_cast<const HistoryTask&>(task));
+        if (task.taskName_ != nullptr) {
+            task.taskName_->DecRef();
+        }
+    }
+
+private:
+    uint32_t Claim() const
+    {
+        uint32_t seq;
+        do {
+            seq = seq_.load(std::memory_order_relaxed) & ~1U;
+        } while (!seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed));
+        return seq;
+    }
+
+    mutable std::atomic_uint32_t seq_ {0};
+    HistoryTask task_;
+};
+
 class EventHandlerAdapterQueue : public EventHandlerInteractiveQueue {
 public:
     explicit EventHandlerAdapterQueue(const char* name);
@@ -67,9 +131,7 @@ public:
 
     uint64_t GetMapSize() override
     {
-        std::lock_guard lock(mutex_);
-        return std::accumulate(std::begin(whenMapVec_), std::end(whenMapVec_), 0u,
-            [] (uint64_t size, const std::multimap<uint64_t, QueueTask*>& whenMap) { return size + whenMap.size(); });
+        return mapSize_.load();
     }
 
     void Stop() override;
@@ -87,8 +149,10 @@ public:
     void PushHistoryTask(QueueTask* task, uint64_t triggerTime, uint64_t completeTime);
 
 private:
-    HistoryTask currentRunningTask_;
-    std::vector<HistoryTask> historyTasks_;
+    static constexpr uint8_t HISTORY_TASK_NUM_POWER = 32;
+
+    HistoryTaskSlot currentRunningTask_;
+    HistoryTaskSlot historyTasks_[HISTORY_TASK_NUM_POWER];
     std::atomic_uint8_t historyTaskIndex_ {0};
     std::vector<int> pulledTaskCount_;
     std::multimap<uint64_t, QueueTask*> whenMapVec_[5];
@@ -192,6 +192,32 @@ bool ffrt_queue_attr_get_thread_mode(const ffrt_queue_attr_t* attr)
     return (reinterpret_cast<ffrt::queue_attr_private*>(p))->threadMode_;
 }
 
+API_ATTRIBUTE((visibility("default")))
+void ffrt_queue_attr_set_run_budget(ffrt_queue_attr_t* attr, uint32_t max_task_num, uint64_t max_time_us)
+{
+    FFRT_COND_DO_ERR((attr == nullptr), return, "input invalid, attr == nullptr");
+
+    ffrt::queue_attr_private* p = reinterpret_cast<ffrt::queue_attr_private*>(attr);
+    p->runBudgetTaskNum_ = max_task_num;
+    p->runBudgetTimeUs_ = max_time_us;
+}
+
+API_ATTRIBUTE((visibility("default")))
+uint32_t ffrt_queue_attr_get_run_budget_task_num(const ffrt_queue_attr_t* attr)
+{
+    FFRT_COND_DO_ERR((attr == nullptr), return 0, "input invalid, attr == nullptr");
+    ffrt_queue_attr_t* p = const_cast<ffrt_queue_attr_t*>(attr);
+    return (reinterpret_cast<ffrt::queue_attr_private*>(p))->runBudgetTaskNum_;
+}
+
+API_ATTRIBUTE((visibility("default")))
+uint64_t ffrt_queue_attr_get_run_budget_time(const ffrt_queue_attr_t* attr)
+{
+    FFRT_COND_DO_ERR((attr == nullptr), return 0, "input invalid, attr == nullptr");
+    ffrt_queue_attr_t* p = const_cast<ffrt_queue_attr_t*>(attr);
+    return (reinterpret_cast<ffrt::queue_attr_private*>(p))->runBudgetTimeUs_;
+}
+
 API_ATTRIBUTE((visibility("default")))
 ffrt_queue_t ffrt_queue_create(ffrt_queue_type_t type, const char* name, const ffrt_queue_attr_t* attr)
 {
@@ -40,6 +40,8 @@ public:
     int maxConcurrency_ = 1;
     ffrt_function_header_t* timeoutCb_ = nullptr;
     bool threadMode_ = false;
+    uint32_t runBudgetTaskNum_ = 0;
+    uint64_t runBudgetTimeUs_ = 0;
 };
 }
 #endif
\ No newline at end of file
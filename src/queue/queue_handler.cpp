@@ -14,6 +14,7 @@
  */
 
 #include "queue/queue_handler.h"
+#include <algorithm>
 #include <sstream>
 #include "concurrent_queue.h"
 #include "eventhandler_adapter_queue.h"
@@ -49,6 +50,10 @@ QueueHandler::QueueHandler(const char* name, const ffrt_queue_attr_t* attr, cons
         timeoutCb_ = ffrt_queue_attr_get_callback(attr);
         maxConcurrency_ = ffrt_queue_attr_get_max_concurrency(attr);
         threadMode_ = ffrt_queue_attr_get_thread_mode(attr);
+        if (type == ffrt_queue_serial) {
+            runBudgetTaskNum_ = ffrt_queue_attr_get_run_budget_task_num(attr);
+            runBudgetTimeUs_ = ffrt_queue_attr_get_run_budget_time(attr);
+        }
     }
 
     // callback reference counting is to ensure life cycle
@@ -59,6 +64,10 @@ QueueHandler::QueueHandler(const char* name, const ffrt_queue_attr_t* attr, cons
     trafficRecord_.SetTimeInterval(trafficRecordInterval_);
     curTaskVec_.resize(maxConcurrency_);
     timeoutTaskVec_.resize(maxConcurrency_);
+    if (timeout_ > 0) {
+        monitorTaskVec_.reserve(maxConcurrency_);
+        timeoutWe_.cb = ([this](WaitEntry* we) { CheckTimeoutTasks(); });
+    }
     nextTp_ = std::chrono::steady_clock::time_point::max();
 
     queue_ = CreateQueue(type, attr, name);
@@ -78,6 +87,13 @@ QueueHandler::~QueueHandler()
 
     // release callback resource
     if (timeout_ > 0) {
+        {
+            std::lock_guard lock(mutex_);
+            if (isTimeoutTimerSet_ && DelayedRemove(timeoutWe_.tp, &timeoutWe_)) {
+                isTimeoutTimerSet_ = false;
+                delayedCbCnt_.fetch_sub(1);
+            }
+        }
         // wait for all delayedWorker to complete.
         uint64_t waitCbCnt = 0;
         while ((delayedCbCnt_.load() > 0) && !GetDelayedWorkerExitFlag()) {
@@ -315,15 +331,17 @@ int QueueHandler::Cancel(QueueTask* task)
 void QueueHandler::Dispatch(QueueTask* inTask)
 {
     QueueTask* nextTask = nullptr;
+    uint64_t startTime = (runBudgetTimeUs_ > 0) ? TimeStampCntvct() : 0;
+    uint32_t runTaskNum = 0;
     for (QueueTask* task = inTask; task != nullptr; task = nextTask) {
 #ifdef FFRT_ENABLE_HITRACE_CHAIN
         if (task->traceId_.valid == HITRACE_ID_VALID) {
             TraceChainAdapter::Instance().HiTraceChainRestoreId(&task->traceId_);
         }
 #endif
+        SetCurTask(task);
         // dfx watchdog
         SetTimeoutMonitor(task);
-        SetCurTask(task);
         execTaskId_.store(task->gid);
 
         // run user task
@@ -370,15 +388,20 @@ void QueueHandler::Dispatch(QueueTask* inTask)
             curTaskVec_[task->curTaskIdx] = nextTask;
         }
         task->DecDeleteRef();
+        runTaskNum++;
         if (nextTask == nullptr && !isOnLoop_) {
             execTaskId_.store(0);
-            Deliver();
+            if (runBudgetTaskNum_ > 0) {
+                nextTask = PullInBudget(inTask, startTime, runTaskNum);
+            } else {
+                Deliver();
+            }
         }
     }
     inTask->SetStatus<TaskStatus::FINISH>();
 }
 
-void QueueHandler::Deliver()
+QueueTask* QueueHandler::PullTask()
 {
     deliverCnt_.fetch_add(1);
     {
@@ -397,12 +420,37 @@ void QueueHandler::Deliver()
     }
     QueueTask* task = queue_->Pull();
     deliverCnt_.fetch_sub(1);
+    return task;
+}
+
+void QueueHandler::Deliver()
+{
+    QueueTask* task = PullTask();
     if (task != nullptr) {
         SetCurTask(task);
         TransferTask(task);
     }
 }
 
+QueueTask* QueueHandler::PullInBudget(QueueTask* inTask, uint64_t startTime, uint32_t runTaskNum)
+{
+    QueueTask* task = PullTask();
+    if (task == nullptr) {
+        return nullptr;
+    }
+    SetCurTask(task);
+
+    // run the next batch on the current worker until the budget is used up, tasks with another qos are scheduled
+    bool inBudget = runTaskNum < runBudgetTaskNum_ &&
+        (runBudgetTimeUs_ == 0 || TimeStampCntvct() - startTime < runBudgetTimeUs_);
+    if (inBudget && task->GetQos() == inTask->GetQos()) {
+        task->ReadyInline();
+        return task;
+    }
+    TransferTask(task);
+    return nullptr;
+}
+
 void QueueHandler::TransferTask(QueueTask* task)
 {
     if (queueType_ == ffrt_queue_eventhandler_adapter) {
@@ -427,59 +475,84 @@ void QueueHandler::SetTimeoutMonitor(QueueTask* task)
         return;
     }
 
-    task->IncDeleteRef();
-
-    // set delayed worker callback
-    auto timeoutWe = new (SimpleAllocator<WaitUntilEntry>::AllocMem()) WaitUntilEntry();
-    timeoutWe->cb = ([this, task](WaitEntry* timeoutWe) {
-        task->MonitorTaskStart();
-        if (!task->GetFinishStatus()) {
-            RunTimeOutCallback(task);
-        }
-        delayedCbCnt_.fetch_sub(1);
-        task->DecDeleteRef();
-        SimpleAllocator<WaitUntilEntry>::FreeMem(static_cast<WaitUntilEntry*>(timeoutWe));
-    });
-
-    // set delayed worker wakeup time
-    std::chrono::microseconds timeout(timeout_);
-    auto now = std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::steady_clock::now());
-    timeoutWe->tp = std::chrono::time_point_cast<std::chrono::steady_clock::duration>(now + timeout);
-    task->SetMonitorTask(timeoutWe);
-
-    delayedCbCnt_.fetch_add(1);
-    if (!DelayedWakeup(timeoutWe->tp, timeoutWe, timeoutWe->cb, true)) {
-        delayedCbCnt_.fetch_sub(1);
-        task->DecDeleteRef();
-        SimpleAllocator<WaitUntilEntry>::FreeMem(timeoutWe);
-        FFRT_LOGW("failed to set watchdog for task gid=%llu in %s with timeout [%llu us] ", task->gid,
-            queue_->GetQueueName().c_str(), timeout_);
-        return;
+    // no timer per task, the start time is checked by a single sweep of this queue
+    uint64_t now = TimeStampCntvct();
+    std::lock_guard lock(mutex_);
+    task->SetExecStartTime(now);
+    monitorTaskVec_.push_back(task);
+    if (!isTimeoutTimerSet_) {
+        // tasks share the same timeout, so an armed sweep never fires later than the deadline of this task
+        delayedCbCnt_.fetch_add(1);
+        SendTimeoutTimer(now + timeout_);
     }
-
     FFRT_LOGD("set watchdog of task gid=%llu of %s succ", task->gid, queue_->GetQueueName().c_str());
 }
 
 void QueueHandler::RemoveTimeoutMonitor(QueueTask* task)
 {
-    if (timeout_ <= 0 || task->IsMonitorTaskStart()) {
+    if (timeout_ <= 0) {
         return;
     }
 
-    if (DelayedRemove(task->GetMonitorTask()->tp, task->GetMonitorTask())) {
+    std::lock_guard lock(mutex_);
+    auto iter = std::find(monitorTaskVec_.begin(), monitorTaskVec_.end(), task);
+    if (iter != monitorTaskVec_.end()) {
+        *iter = monitorTaskVec_.back();
+        monitorTaskVec_.pop_back();
+    }
+}
+
+void QueueHandler::SendTimeoutTimer(uint64_t deadline)
+{
+    timeoutWe_.tp = std::chrono::time_point_cast<std::chrono::steady_clock::duration>(
+        std::chrono::steady_clock::time_point() + std::chrono::microseconds(deadline));
+    isTimeoutTimerSet_ = DelayedWakeup(timeoutWe_.tp, &timeoutWe_, timeoutWe_.cb, true);
+    if (!isTimeoutTimerSet_) {
         delayedCbCnt_.fetch_sub(1);
-        task->DecDeleteRef();
-        SimpleAllocator<WaitUntilEntry>::FreeMem(static_cast<WaitUntilEntry*>(task->GetMonitorTask()));
+        FFRT_LOGW("failed to set watchdog for %s with timeout [%llu us] ", queue_->GetQueueName().c_str(), timeout_);
+    }
+}
+
+void QueueHandler::CheckTimeoutTasks()
+{
+    std::vector<std::pair<uint64_t, std::string>> timeoutTaskInfo;
+    {
+        std::lock_guard lock(mutex_);
+        uint64_t now = TimeStampCntvct();
+        uint64_t nextDeadline = UINT64_MAX;
+        for (QueueTask* task : monitorTaskVec_) {
+            if (task->IsTimeoutReported() || task->GetFinishStatus()) {
+                continue;
+            }
+            uint64_t deadline = task->GetExecStartTime() + timeout_;
+            if (deadline <= now) {
+                task->SetTimeoutReported();
+                timeoutTaskInfo.emplace_back(task->gid, task->label);
+            } else {
+                nextDeadline = std::min(nextDeadline, deadline);
+            }
+        }
+
+        isTimeoutTimerSet_ = false;
+        if (nextDeadline != UINT64_MAX) {
+            delayedCbCnt_.fetch_add(1);
+            SendTimeoutTimer(nextDeadline);
+        }
+    }
+
+    for (const auto& info : timeoutTaskInfo) {
+        RunTimeOutCallback(info.first, info.second);
     }
+    delayedCbCnt_.fetch_sub(1);
 }
 
-void QueueHandler::RunTimeOutCallback(QueueTask* task)
+void QueueHandler::RunTimeOutCallback(uint64_t gid, const std::string& label)
 {
     std::stringstream ss;
     std::string processNameStr = GetCurrentProcessName();
     ss << "[Serial_Queue_Timeout_Callback] process name:[" << processNameStr << "], serial queue:[" <<
-        queue_->GetQueueName() << "], queueId:[" << GetQueueId() << "], serial task gid:[" << task->gid
-        <<"], task name:[" << task->label << "], execution time exceeds[" << timeout_ << "] us";
+        queue_->GetQueueName() << "], queueId:[" << GetQueueId() << "], serial task gid:[" << gid
+        <<"], task name:[" << label << "], execution time exceeds[" << timeout_ << "] us";
     FFRT_LOGE("%s", ss.str().c_str());
     if (timeoutCb_ != nullptr) {
         QueueTask* cbTask = GetQueueTaskByFuncStorageOffset(timeoutCb_);
@@ -150,9 +150,13 @@ public:
 
 private:
     void Deliver();
+    QueueTask* PullTask();
+    QueueTask* PullInBudget(QueueTask* inTask, uint64_t startTime, uint32_t runTaskNum);
     void SetTimeoutMonitor(QueueTask* task);
     void RemoveTimeoutMonitor(QueueTask* task);
-    void RunTimeOutCallback(QueueTask* task);
+    void CheckTimeoutTasks();
+    void SendTimeoutTimer(uint64_t deadline);
+    void RunTimeOutCallback(uint64_t gid, const std::string& label);
 
     void ReportTimeout(const std::vector<std::tuple<uint64_t, std::string, ffrt_function_header_t*>>& timeoutTaskInfo);
     bool ControlTimeoutFreq(uint64_t timeoutCnt);
@@ -173,6 +177,8 @@ private:
     std::atomic_bool isUsed_ = false;
     std::atomic_uint64_t execTaskId_ = 0;
     int maxConcurrency_ = 1;
+    uint32_t runBudgetTaskNum_ = 0; // serial queue only, 0 means returning to the scheduler after each batch
+    uint64_t runBudgetTimeUs_ = 0;
     std::vector<QueueTask*> curTaskVec_;
     uint64_t desWaitCnt_ = 0;
 
@@ -180,6 +186,9 @@ private:
     uint64_t timeout_ = 0;
     std::vector<TimeoutQueueTask> timeoutTaskVec_;
     std::atomic_int delayedCbCnt_ = {0};
+    std::vector<QueueTask*> monitorTaskVec_; // executing tasks checked by the timeout sweep, guarded by mutex_
+    WaitUntilEntry timeoutWe_; // single sweep timer shared by all tasks of the queue
+    bool isTimeoutTimerSet_ = false;
     ffrt_function_header_t* timeoutCb_ = nullptr;
     TrafficRecord trafficRecord_;
     uint64_t trafficRecordInterval_ = DEFAULT_TRAFFIC_INTERVAL;
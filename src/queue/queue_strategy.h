@@ -26,11 +26,13 @@ namespace ffrt {
 template<typename T>
 class QueueStrategy {
 public:
-    using DequeFunc = T*(*)(const uint32_t, const uint64_t, std::multimap<uint64_t, T*>*, void*);
+    // readyBitmap: bit idx is set when whenMapVec[idx] is not empty
+    using DequeFunc = T*(*)(const uint32_t, const uint64_t, std::multimap<uint64_t, T*>*, const uint32_t, void*);
 
     static T* DequeBatch(const uint32_t queueId, const uint64_t now,
-        std::multimap<uint64_t, T*>* whenMapIn, void* args)
+        std::multimap<uint64_t, T*>* whenMapIn, const uint32_t readyBitmap, void* args)
     {
+        (void)readyBitmap;
         (void)args;
         auto& whenMap = *whenMapIn;
         // dequeue due tasks in batch
@@ -55,16 +57,17 @@ public:
     }
 
     static T* DequeSingleByPriority(const uint32_t queueId,
-        const uint64_t now, std::multimap<uint64_t, T*>* whenMapVec, void* args)
+        const uint64_t now, std::multimap<uint64_t, T*>* whenMapVec, const uint32_t readyBitmap, void* args)
     {
         (void)args;
-        // dequeue next expired task by priority
+        // dequeue next expired task by priority, empty priorities are skipped by the bitmap
         int iterIndex = ffrt_queue_priority_idle;
         auto iterTarget = whenMapVec[iterIndex].cbegin();
 
-        for (int idx = ffrt_queue_priority_immediate; idx <= ffrt_queue_priority_idle; idx++) {
+        for (uint32_t bits = readyBitmap; bits != 0; bits &= bits - 1) {
+            int idx = __builtin_ctz(bits);
             const auto& currentMap = whenMapVec[idx];
-            if (!currentMap.empty() && currentMap.cbegin()->first <= now) {
+            if (currentMap.cbegin()->first <= now) {
                 iterTarget = currentMap.cbegin();
                 iterIndex = idx;
                 break;
@@ -74,42 +77,38 @@ public:
         whenMapVec[iterIndex].erase(iterTarget);
         head->Dequeue();
 
-        size_t mapCount = 0;
-        for (int idx = ffrt_queue_priority_immediate; idx <= ffrt_queue_priority_idle; idx++) {
-            mapCount += whenMapVec[idx].size();
-        }
-        FFRT_LOGD("dequeue [gid=%llu], %u other tasks in [queueId=%u] ", head->gid, mapCount, queueId);
+        FFRT_LOGD("dequeue [gid=%llu], ready bitmap 0x%x in [queueId=%u] ", head->gid, readyBitmap, queueId);
         return head;
     }
 
     static T* DequeSingleAgainstStarvation(const uint32_t queueId,
-        const uint64_t now, std::multimap<uint64_t, T*>* whenMapVec, void* args)
+        const uint64_t now, std::multimap<uint64_t, T*>* whenMapVec, const uint32_t readyBitmap, void* args)
     {
         // dequeue in descending order of priority
         // a low-priority task is dequeued every time five high-priority tasks are dequeued
         constexpr int maxPullTaskCount = 5;
+        constexpr uint32_t idleMask = 1u << ffrt_inner_queue_priority_idle;
         std::vector<int>* pulledTaskCount = static_cast<std::vector<int>*>(args);
 
         int iterIndex = ffrt_inner_queue_priority_idle;
         auto iterTarget = whenMapVec[iterIndex].cbegin();
-        for (int idx = 0; idx < ffrt_inner_queue_priority_idle; idx++) {
+        for (uint32_t bits = readyBitmap & ~idleMask; bits != 0; bits &= bits - 1) {
+            int idx = __builtin_ctz(bits);
             const auto& currentMap = whenMapVec[idx];
-            if (currentMap.empty()) {
-                continue;
-            }
             if (whenMapVec[iterIndex].empty() || iterTarget->first > currentMap.cbegin()->first) {
                 iterIndex = idx;
                 iterTarget = currentMap.cbegin();
             }
         }
 
-        for (int idx = 0; idx < ffrt_inner_queue_priority_idle; idx++) {
+        for (uint32_t bits = readyBitmap & ~idleMask; bits != 0; bits &= bits - 1) {
+            int idx = __builtin_ctz(bits);
             if ((*pulledTaskCount)[idx] >= maxPullTaskCount) {
                 continue;
             }
 
             const auto& currentMap = whenMapVec[idx];
-            if (!currentMap.empty() && currentMap.cbegin()->first < now) {
+            if (currentMap.cbegin()->first < now) {
                 iterTarget = currentMap.cbegin();
                 iterIndex = idx;
                 break;
@@ -125,13 +124,8 @@ public:
         whenMapVec[iterIndex].erase(iterTarget);
         head->Dequeue();
 
-        size_t mapCount = 0;
-        for (int idx = 0; idx <= ffrt_inner_queue_priority_idle; idx++) {
-            auto& currentMap = whenMapVec[idx];
-            mapCount += currentMap.size();
-        }
-        FFRT_LOGD("dequeue [gid=%llu], prio %d, %u other tasks in [queueId=%u] ",
-            head->gid, head->GetPriority(), mapCount, queueId);
+        FFRT_LOGD("dequeue [gid=%llu], prio %d, ready bitmap 0x%x in [queueId=%u] ",
+            head->gid, head->GetPriority(), readyBitmap, queueId);
 
         return head;
     }
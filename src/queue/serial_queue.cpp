@@ -94,7 +94,7 @@ QueueTask* SerialQueue::Pull()
         overloadThreshold_ = MAX_OVERLOAD_INTERVAL;
     }
     // dequeue due tasks in batch
-    return dequeFunc_(queueId_, now, &whenMap_, nullptr);
+    return dequeFunc_(queueId_, now, &whenMap_, 1u, nullptr);
 }
 
 std::unique_ptr<BaseQueue> CreateSerialQueue(const ffrt_queue_attr_t* attr, const char* name)
@@ -17,6 +17,7 @@
 #include "c/deadline.h"
 #include "internal_inc/osal.h"
 #include "sched/interval.h"
+#include "sched/execute_ctx.h"
 #include "dm/dependence_manager.h"
 #include "sched/frame_interval.h"
 #include "dfx/log/ffrt_log_api.h"
@@ -48,6 +49,12 @@ public:
 private:
     std::unique_ptr<Interval> it;
 };
+
+// tasks submitted from this thread inherit the deadline of the interval, see ffrt_task_attr_set_deadline
+static inline void SetThreadIntervalDeadline(QosIntervalPrivate* it)
+{
+    ExecuteCtx::Cur()->intervalDeadlineUs = it != nullptr ? (*it)->Ddl().AbsNs() / NS_PER_US : 0;
+}
 }; // namespace ffrt
 
 #ifdef __cplusplus
@@ -86,6 +93,9 @@ int ffrt_interval_update(ffrt_interval_t it, uint64_t new_deadline_us)
     auto _it = static_cast<ffrt::QosIntervalPrivate *>(it);
 
     (*_it)->Update(new_deadline_us);
+    if (ffrt::ExecuteCtx::Cur()->intervalDeadlineUs != 0) {
+        ffrt::SetThreadIntervalDeadline(_it);
+    }
     return ffrt_success;
 }
 
@@ -99,7 +109,12 @@ int ffrt_interval_begin(ffrt_interval_t it)
 
     auto _it = static_cast<ffrt::QosIntervalPrivate *>(it);
 
-    return (*_it)->Begin();
+    int ret = (*_it)->Begin();
+    if (ret == 0) {
+        (*_it)->Ddl().Restart();
+        ffrt::SetThreadIntervalDeadline(_it);
+    }
+    return ret;
 }
 
 API_ATTRIBUTE((visibility("default")))
@@ -113,6 +128,7 @@ int ffrt_interval_end(ffrt_interval_t it)
     auto _it = static_cast<ffrt::QosIntervalPrivate *>(it);
 
     (*_it)->End();
+    ffrt::SetThreadIntervalDeadline(nullptr);
     return ffrt_success;
 }
 
@@ -139,6 +155,7 @@ int ffrt_interval_join(ffrt_interval_t it)
     auto _it = static_cast<ffrt::QosIntervalPrivate *>(it);
 
     (*_it)->Join();
+    ffrt::SetThreadIntervalDeadline(_it);
     return ffrt_success;
 }
 
@@ -153,6 +170,7 @@ int ffrt_interval_leave(ffrt_interval_t it)
     auto _it = static_cast<ffrt::QosIntervalPrivate *>(it);
 
     (*_it)->Leave();
+    ffrt::SetThreadIntervalDeadline(nullptr);
     return ffrt_success;
 }
 #ifdef __cplusplus
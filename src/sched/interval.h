@@ -62,6 +62,17 @@ public:
         return left;
     }
 
+    uint64_t AbsNs() const
+    {
+        return absDeadlineNs;
+    }
+
+    // starts counting the deadline from now, e.g. at the beginning of a frame
+    void Restart()
+    {
+        absDeadlineNs = deadlineNs + AbsNowNs();
+    }
+
     void Update(uint64_t deadlineUs);
 
 private:
@@ -29,4 +29,18 @@ bool Scheduler::CancelUVWork(ffrt_executor_task_t* uvWork, int qos)
     return GetScheduler(qos).CancelUVWork(uvWork);
 }
 
+API_ATTRIBUTE((visibility("default")))
+int set_sched_policy(qos qos_, std::unique_ptr<sched_policy> policy)
+{
+    if (qos_ < QoS::Min() || qos_ >= QoS::Max()) {
+        FFRT_LOGE("qos [%d] is invalid", qos_);
+        return ffrt_error_inval;
+    }
+    if (!FFRTFacade::GetScheduler().GetScheduler(QoS(qos_)).SetCustomPolicy(std::move(policy))) {
+        FFRT_LOGE("qos [%d] does not support custom sched policy", qos_);
+        return ffrt_error_inval;
+    }
+    return ffrt_success;
+}
+
 } // namespace ffrt
\ No newline at end of file
@@ -15,7 +15,9 @@
 
 #ifndef FFRT_STASK_SCHEDULER_HPP
 #define FFRT_STASK_SCHEDULER_HPP
+#include <sched.h>
 #include "sched/task_scheduler.h"
+#include "cpp/sched_policy.h"
 #include "dfx/trace/ffrt_trace.h"
 #include "tm/uv_task.h"
 #include "util/ffrt_facade.h"
@@ -25,7 +27,7 @@ class STaskScheduler : public TaskScheduler {
 public:
     STaskScheduler()
     {
-        que = std::make_unique<FIFOQueue>();
+        que = std::make_unique<PriorityFIFOQueue>();
     }
 
     void SetQos(QoS &q) override
@@ -36,17 +38,63 @@ public:
 
     uint64_t GetGlobalTaskCnt() override
     {
-        return que->Size();
+        return que->Size() + edfQue.Size() + policySize.load(std::memory_order_relaxed);
     }
 
     uint64_t GetRTQTaskCnt() override
     {
-        return que->Size();
+        return GetGlobalTaskCnt();
     }
 
     bool GlobalTaskEmpty() override
     {
-        return que->Empty();
+        return que->Empty() && edfQue.Empty() && policySize.load(std::memory_order_relaxed) == 0;
+    }
+
+    bool SetPolicy(ffrt_sched_policy policy) override
+    {
+        if (policy != ffrt_sched_policy_fifo && policy != ffrt_sched_policy_edf) {
+            return false;
+        }
+        edf.store(policy == ffrt_sched_policy_edf, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool SetCustomPolicy(std::unique_ptr<sched_policy> newPolicy) override
+    {
+        std::unique_ptr<sched_policy> oldPolicy;
+        {
+            std::lock_guard<std::mutex> lock(*mtx);
+            if (policy == nullptr && newPolicy == nullptr) {
+                return true;
+            }
+            oldPolicy = std::move(policy);
+            policy = std::move(newPolicy);
+            // hand the queued tasks over in the order the previous queue would have run them
+            for (;;) {
+                TaskBase* task = oldPolicy ? static_cast<TaskBase*>(oldPolicy->pop().handle) : DeQueueBuiltin();
+                if (task == nullptr) {
+                    break;
+                }
+                EnQueue(task);
+            }
+            policySize.store(policy ? policy->size() : 0, std::memory_order_relaxed);
+            hasPolicy.store(policy != nullptr, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // the queue order wins over running next: a custom policy sees every task, a task readied next must not pass
+    // a queued task with a deadline under edf or one of a higher priority
+    bool CanRunNext(TaskBase* task) override
+    {
+        if (hasPolicy.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        if (edf.load(std::memory_order_relaxed) && !edfQue.Empty()) {
+            return false;
+        }
+        return !que->HigherQueued(task->schedPrio_);
     }
 
     bool PushTask(TaskBase* task, bool rtb) override
@@ -66,8 +114,8 @@ public:
         {
             std::lock_guard lg(*mtx);
             // enqueue task and read size under lock-protection
-            que->EnQueue(task);
-            taskCount = que->Size();
+            EnQueue(task);
+            taskCount = GetGlobalTaskCnt();
         }
 
         // The ownership of the task belongs to ReadyTaskQueue, and the task cannot be accessed any more.
@@ -84,11 +132,26 @@ public:
     TaskBase* PopTask() override
     {
         FFRT_PERF_TRACE_SCOPED_BY_GROUP(SCHED, STaskScheduler_PopTask, DEFAULT_CONFIG);
+        return PopTask(false);
+    }
+
+    TaskBase* StealTask() override
+    {
+        return PopTask(true);
+    }
+private:
+    TaskBase* PopTask(bool steal)
+    {
         TaskBase* task = nullptr;
         {
             // pop from global queue
             std::lock_guard<std::mutex> lock(*mtx);
-            task = que->DeQueue();
+            if (policy == nullptr) {
+                task = DeQueueBuiltin();
+            } else {
+                task = static_cast<TaskBase*>((steal ? policy->steal() : policy->pop()).handle);
+                policySize.store(policy->size(), std::memory_order_relaxed);
+            }
         }
 
         if (task && task->type == ffrt_uv_task) {
@@ -96,8 +159,39 @@ public:
         }
         return task;
     }
-private:
-    std::unique_ptr<FIFOQueue> que { nullptr };
+
+    void EnQueue(TaskBase* task)
+    {
+        if (policy != nullptr) {
+            ready_task ready;
+            ready.handle = task;
+            ready.id = task->gid;
+            ready.priority = static_cast<ffrt_task_priority_t>(task->schedPrio_);
+            ready.deadline_us = task->deadlineUs_;
+            policy->push(ready);
+            policySize.store(policy->size(), std::memory_order_relaxed);
+        } else if (task->deadlineUs_ != 0 && edf.load(std::memory_order_relaxed)) {
+            edfQue.EnQueue(task);
+        } else {
+            que->EnQueue(task);
+        }
+    }
+
+    // tasks queued by deadline go first even once the policy is back to fifo, but age the priorities they pass
+    TaskBase* DeQueueBuiltin()
+    {
+        if (!edfQue.Empty() && !que->PassOver()) {
+            return edfQue.DeQueue();
+        }
+        return que->DeQueue(que->HintedQueued() ? sched_getcpu() : -1);
+    }
+
+    std::unique_ptr<PriorityFIFOQueue> que { nullptr };
+    EDFQueue edfQue;
+    std::atomic<bool> edf { false };
+    std::unique_ptr<sched_policy> policy { nullptr }; // replaces the queues above when set
+    std::atomic<size_t> policySize { 0 };
+    std::atomic<bool> hasPolicy { false };
 };
 }
 #endif
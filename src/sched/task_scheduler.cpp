@@ -15,84 +15,110 @@
 
 #include "sched/task_scheduler.h"
 #include <random>
+#include <thread>
 #include "eu/execute_unit.h"
 #include "util/ffrt_facade.h"
 
 namespace {
-constexpr int UV_TASK_MAX_CONCURRENCY = 8;
+constexpr uintptr_t UV_CANCEL_GUARD_SHIFT = 6;
 } // namespace
 
 namespace ffrt {
-bool TaskScheduler::PushUVTaskToWaitingQueue(UVTask* task)
+/*
+ * Every step below is a seq_cst operation. A submitter increments uvWaitingCnt_ before it checks uvRunning_,
+ * a completion decrements uvRunning_ before it checks uvWaitingCnt_, so at least one of them sees the other
+ * and no task is left waiting while no permit is taken.
+ */
+bool TaskScheduler::TryAcquireUVPermit()
 {
-    std::lock_guard lg(uvMtx);
-    if (uvTaskConcurrency_ >= UV_TASK_MAX_CONCURRENCY) {
-        uvTaskWaitingQueue_.push_back(task);
-        return true;
+    int running = uvRunning_.load();
+    while (running < uvLimit_.load()) {
+        if (uvRunning_.compare_exchange_weak(running, running + 1)) {
+            return true;
+        }
     }
-
     return false;
 }
 
-bool TaskScheduler::CheckUVTaskConcurrency(UVTask* task)
+UVTask* TaskScheduler::PopWaitingUVTask()
 {
-    std::lock_guard lg(uvMtx);
-    // the number of workers executing UV tasks has reached the upper limit.
-    // therefore, the current task is placed back to the head of the waiting queue (be preferentially obtained later).
-    if (uvTaskConcurrency_ >= UV_TASK_MAX_CONCURRENCY) {
-        uvTaskWaitingQueue_.push_front(task);
-        return false;
+    std::lock_guard lg(uvPopMtx_);
+    while (UVTask* task = uvWaitingList_.Pop(&UVTask::waitNode)) {
+        uvWaitingCnt_.fetch_sub(1);
+        if (task->TryClaim()) {
+            return task;
+        }
+        task->FreeMem();
     }
+    return nullptr;
+}
 
-    uvTaskConcurrency_++;
-    return true;
+UVTask* TaskScheduler::AcquireUVPermit(UVTask* task)
+{
+    if (TryAcquireUVPermit()) {
+        return task;
+    }
+
+    uvWaitingCnt_.fetch_add(1);
+    uvWaitingList_.Push(&task->waitNode);
+    // the tasks holding the permits may all have completed before the task was counted
+    if (!TryAcquireUVPermit()) {
+        return nullptr;
+    }
+    return ReleaseUVPermit();
 }
 
-UVTask* TaskScheduler::PickWaitingUVTask()
+UVTask* TaskScheduler::ReleaseUVPermit()
 {
-    std::lock_guard lg(uvMtx);
-    if (uvTaskWaitingQueue_.empty()) {
-        if (uvTaskConcurrency_ > 0) {
-            uvTaskConcurrency_--;
+    for (;;) {
+        if (uvWaitingCnt_.load() > 0 && uvRunning_.load() <= uvLimit_.load()) {
+            UVTask* task = PopWaitingUVTask();
+            if (task != nullptr) {
+                return task;
+            }
+        }
+        uvRunning_.fetch_sub(1);
+        // a pop returns nothing while a push is half done, retry if the task is still not taken
+        if (uvWaitingCnt_.load() == 0 || !TryAcquireUVPermit()) {
+            return nullptr;
         }
-        return nullptr;
     }
+}
 
-    UVTask* task = uvTaskWaitingQueue_.front();
-    uvTaskWaitingQueue_.pop_front();
-    task->SetDequeued();
-    return task;
+void TaskScheduler::SetUVTaskMaxConcurrency(uint32_t num)
+{
+    uvLimit_.store(static_cast<int>(num));
+    while (uvWaitingCnt_.load() > 0 && TryAcquireUVPermit()) {
+        UVTask* task = ReleaseUVPermit();
+        if (task == nullptr) {
+            break;
+        }
+        UVTask::PushReady(task);
+    }
 }
 
 bool TaskScheduler::CancelUVWork(ffrt_executor_task_t* uvWork)
 {
-    std::lock_guard lg(uvMtx);
-    if (!reinterpret_cast<LinkedList*>(uvWork->wq)->InList()) {
+    // the task found through uvWork is not freed until the cancel is done, see UVTask::FreeMem
+    std::atomic<int>& guard = uvCancelling_[(reinterpret_cast<uintptr_t>(uvWork) >> UV_CANCEL_GUARD_SHIFT) %
+        UV_CANCEL_GUARD_NUM];
+    guard.fetch_add(1);
+    UVTask* task = UVTask::FromWork(uvWork);
+    bool cancelled = task != nullptr && task->TryCancel();
+    guard.fetch_sub(1);
+    if (!cancelled) {
         FFRT_SYSEVENT_LOGW("the task has been picked, or has not been inserted");
-        return false;
     }
+    return cancelled;
+}
 
-    auto iter = std::remove_if(uvTaskWaitingQueue_.begin(), uvTaskWaitingQueue_.end(), [this, uvWork](UVTask* task) {
-        if (task->uvWork == uvWork) {
-            // SetDequeued writes to user-allocated uvWork, we must ensure it wasn't previously cancelled.
-            if (cancelSet_.find(uvWork) == cancelSet_.end()) {
-                task->SetDequeued();
-            }
-            return true;
-        }
-        return false;
-    });
-    if (iter != uvTaskWaitingQueue_.end()) {
-        uvTaskWaitingQueue_.erase(iter, uvTaskWaitingQueue_.end());
-        if (cancelSet_.find(uvWork) != cancelSet_.end()) {
-            // We erase uvWork from set which was cancelled before to avoid memory leak.
-            cancelSet_.erase(uvWork);
-            return false;
-        }
-        return true;
+void TaskScheduler::WaitUVCancelDone(const ffrt_executor_task_t* uvWork)
+{
+    std::atomic<int>& guard = uvCancelling_[(reinterpret_cast<uintptr_t>(uvWork) >> UV_CANCEL_GUARD_SHIFT) %
+        UV_CANCEL_GUARD_NUM];
+    while (guard.load() != 0) {
+        std::this_thread::yield();
     }
-    LinkedList::RemoveCur(reinterpret_cast<LinkedList*>(&uvWork->wq));
-    return cancelSet_.insert(uvWork).second;
 }
 
 SchedulerFactory &SchedulerFactory::Instance()
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync/semaphore_private.h"
+#include "c/barrier.h"
+#include "dfx/log/ffrt_log_api.h"
+#include "internal_inc/osal.h"
+
+namespace ffrt {
+void LatchPrivate::CountDown(uint32_t n)
+{
+    parkList.EnterWake();
+    int64_t v = count.fetch_sub(n, std::memory_order_acq_rel);
+    if (v == static_cast<int64_t>(n)) {
+        parkList.UnparkAll();
+    } else if (v < static_cast<int64_t>(n)) {
+        FFRT_LOGE("latch count down by %u exceeds the counter %lld", n, static_cast<long long>(v));
+    }
+    parkList.ExitWake();
+}
+
+void LatchPrivate::Wait()
+{
+    while (!TryWait()) {
+        parkList.Park([this] { return TryWait(); });
+    }
+}
+
+uint64_t BarrierPrivate::Arrive(bool drop)
+{
+    parkList.EnterWake();
+    // the phase cannot move on before this arrival, so it is the phase being arrived at
+    uint64_t cur = phase.load(std::memory_order_acquire);
+    if (drop) {
+        expected.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // the last arrival resets the counter for the next phase before releasing anyone into it
+        remaining.store(expected.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        phase.fetch_add(1, std::memory_order_release);
+        parkList.UnparkAll();
+    }
+    parkList.ExitWake();
+    return cur;
+}
+
+void BarrierPrivate::ArriveAndWait()
+{
+    uint64_t cur = Arrive(false);
+    while (phase.load(std::memory_order_acquire) == cur) {
+        parkList.Park([this, cur] { return phase.load(std::memory_order_acquire) != cur; });
+    }
+}
+} // namespace ffrt
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+API_ATTRIBUTE((visibility("default")))
+int ffrt_latch_init(ffrt_latch_t* latch, uint32_t count)
+{
+    FFRT_COND_DO_ERR((latch == nullptr), return ffrt_error_inval, "latch should not be empty");
+    static_assert(sizeof(ffrt::LatchPrivate) <= ffrt_latch_storage_size,
+        "size must be less than ffrt_latch_storage_size");
+
+    new (latch) ffrt::LatchPrivate(count);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_latch_count_down(ffrt_latch_t* latch, uint32_t n)
+{
+    FFRT_COND_DO_ERR((latch == nullptr), return ffrt_error_inval, "latch should not be empty");
+    reinterpret_cast<ffrt::LatchPrivate*>(latch)->CountDown(n);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_latch_try_wait(ffrt_latch_t* latch)
+{
+    FFRT_COND_DO_ERR((latch == nullptr), return ffrt_error_inval, "latch should not be empty");
+    return reinterpret_cast<ffrt::LatchPrivate*>(latch)->TryWait() ? ffrt_success : ffrt_error_busy;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_latch_wait(ffrt_latch_t* latch)
+{
+    FFRT_COND_DO_ERR((latch == nullptr), return ffrt_error_inval, "latch should not be empty");
+    reinterpret_cast<ffrt::LatchPrivate*>(latch)->Wait();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_latch_arrive_and_wait(ffrt_latch_t* latch, uint32_t n)
+{
+    FFRT_COND_DO_ERR((latch == nullptr), return ffrt_error_inval, "latch should not be empty");
+    auto p = reinterpret_cast<ffrt::LatchPrivate*>(latch);
+    p->CountDown(n);
+    p->Wait();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_latch_destroy(ffrt_latch_t* latch)
+{
+    FFRT_COND_DO_ERR((latch == nullptr), return ffrt_error_inval, "latch should not be empty");
+    reinterpret_cast<ffrt::LatchPrivate*>(latch)->~LatchPrivate();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_barrier_init(ffrt_barrier_t* barrier, uint32_t count)
+{
+    FFRT_COND_DO_ERR((barrier == nullptr), return ffrt_error_inval, "barrier should not be empty");
+    FFRT_COND_DO_ERR((count == 0), return ffrt_error_inval, "barrier count should not be zero");
+    static_assert(sizeof(ffrt::BarrierPrivate) <= ffrt_barrier_storage_size,
+        "size must be less than ffrt_barrier_storage_size");
+
+    new (barrier) ffrt::BarrierPrivate(count);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_barrier_arrive_and_wait(ffrt_barrier_t* barrier)
+{
+    FFRT_COND_DO_ERR((barrier == nullptr), return ffrt_error_inval, "barrier should not be empty");
+    reinterpret_cast<ffrt::BarrierPrivate*>(barrier)->ArriveAndWait();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_barrier_arrive_and_drop(ffrt_barrier_t* barrier)
+{
+    FFRT_COND_DO_ERR((barrier == nullptr), return ffrt_error_inval, "barrier should not be empty");
+    reinterpret_cast<ffrt::BarrierPrivate*>(barrier)->ArriveAndDrop();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_barrier_destroy(ffrt_barrier_t* barrier)
+{
+    FFRT_COND_DO_ERR((barrier == nullptr), return ffrt_error_inval, "barrier should not be empty");
+    reinterpret_cast<ffrt::BarrierPrivate*>(barrier)->~BarrierPrivate();
+    return ffrt_success;
+}
+#ifdef __cplusplus
+}
+#endif
@@ -17,6 +17,7 @@
 #include "c/condition_variable.h"
 #include "sync/wait_queue.h"
 #include "sync/mutex_private.h"
+#include "sync/lock_profiler.h"
 #include "internal_inc/osal.h"
 #include "dfx/log/ffrt_log_api.h"
 
@@ -91,6 +92,16 @@ int ffrt_cond_wait(ffrt_cond_t* cond, ffrt_mutex_t* mutex)
     }
     auto pc = reinterpret_cast<ffrt::condition_variable_private *>(cond);
     auto pm = reinterpret_cast<ffrt::mutexPrivate *>(mutex);
+    // the mutex is released while waiting, which ends its hold
+    ffrt::LockProfiler::EndHold(mutex);
+    if unlikely(ffrt::LockProfiler::ShouldSample()) {
+        return ffrt::LockProfiler::ProfileWait(cond, pc->WaiterNum(), __builtin_return_address(0), [pc, pm] {
+            ffrt::LockWaiterGuard guard(pc->WaiterNum());
+            pc->SuspendAndWait(pm);
+            return static_cast<int>(ffrt_success);
+        });
+    }
+    ffrt::LockWaiterGuard guard(pc->WaiterNum());
     pc->SuspendAndWait(pm);
     return ffrt_success;
 }
@@ -113,12 +124,16 @@ int ffrt_cond_timedwait(ffrt_cond_t* cond, ffrt_mutex_t* mutex, const struct tim
     auto pc = reinterpret_cast<ffrt::condition_variable_private *>(cond);
     auto pm = reinterpret_cast<ffrt::mutexPrivate *>(mutex);
 
-    using namespace std::chrono;
-    auto duration = seconds{ time_point->tv_sec } + nanoseconds{ time_point->tv_nsec };
-    auto tp = ffrt::TimePoint {
-        duration_cast<steady_clock::duration>(duration_cast<nanoseconds>(duration))
-    };
+    auto tp = ffrt::ToTimePoint(*time_point);
 
+    ffrt::LockProfiler::EndHold(mutex);
+    if unlikely(ffrt::LockProfiler::ShouldSample()) {
+        return ffrt::LockProfiler::ProfileWait(cond, pc->WaiterNum(), __builtin_return_address(0), [pc, pm, &tp] {
+            ffrt::LockWaiterGuard guard(pc->WaiterNum());
+            return pc->SuspendAndWaitUntil(pm, tp);
+        });
+    }
+    ffrt::LockWaiterGuard guard(pc->WaiterNum());
     return pc->SuspendAndWaitUntil(pm, tp);
 }
 
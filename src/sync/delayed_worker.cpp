@@ -97,6 +97,8 @@ void DelayedWorker::DumpMap()
 
 void DelayedWorker::ThreadInit()
 {
+    // the flag key must exist before the thread sets it, or it aliases the first key created in the process
+    ThreadEnvCreate();
     if (delayedWorker != nullptr && delayedWorker->joinable()) {
         delayedWorker->join();
     }
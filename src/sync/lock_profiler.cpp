@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync/lock_profiler.h"
+#include <dlfcn.h>
+#include <algorithm>
+#include <map>
+#include <new>
+#include <sstream>
+#include <vector>
+#include <securec.h>
+#include "sched/execute_ctx.h"
+
+namespace {
+constexpr uint32_t RING_SLOT_NUM = 128;
+constexpr uint32_t MAX_RING_NUM = 1024;
+constexpr uint32_t PENDING_HOLD_NUM = 64;
+constexpr uint32_t PENDING_HOLD_ADDR_SHIFT = 4;
+constexpr uint32_t DUMP_TOP_NUM = 32;
+constexpr uint32_t UINT32_BITS = 32;
+constexpr uint64_t NOT_MEASURED = UINT64_MAX;
+constexpr uintptr_t PENDING_BUSY = 1;
+constexpr uint64_t TASK_OWNER_FLAG = 0x8000000000000000;
+
+struct LockSample {
+    uintptr_t lock = 0;
+    uintptr_t site = 0;
+    uint64_t waitUs = NOT_MEASURED;
+    uint64_t holdUs = NOT_MEASURED;
+    uint64_t idleUs = NOT_MEASURED;
+    uint32_t waiters = 0;
+    ffrt::LockProfileType type = ffrt::LockProfileType::MUTEX;
+};
+
+// one slot of a per-thread ring, written by its thread only and read by dump through a sequence counter
+class LockSampleSlot {
+public:
+    void Store(const LockSample& sample)
+    {
+        uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        data_[LOCK].store(sample.lock, std::memory_order_relaxed);
+        data_[SITE].store(sample.site, std::memory_order_relaxed);
+        data_[WAIT_US].store(sample.waitUs, std::memory_order_relaxed);
+        data_[HOLD_US].store(sample.holdUs, std::memory_order_relaxed);
+        data_[IDLE_US].store(sample.idleUs, std::memory_order_relaxed);
+        data_[TYPE_AND_WAITERS].store((static_cast<uint64_t>(sample.type) << UINT32_BITS) | sample.waiters,
+            std::memory_order_relaxed);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    bool Load(LockSample& sample) const
+    {
+        uint32_t seq;
+        do {
+            seq = seq_.load(std::memory_order_acquire);
+            sample.lock = data_[LOCK].load(std::memory_order_relaxed);
+            sample.site = data_[SITE].load(std::memory_order_relaxed);
+            sample.waitUs = data_[WAIT_US].load(std::memory_order_relaxed);
+            sample.holdUs = data_[HOLD_US].load(std::memory_order_relaxed);
+            sample.idleUs = data_[IDLE_US].load(std::memory_order_relaxed);
+            uint64_t typeAndWaiters = data_[TYPE_AND_WAITERS].load(std::memory_order_relaxed);
+            sample.type = static_cast<ffrt::LockProfileType>(typeAndWaiters >> UINT32_BITS);
+            sample.waiters = static_cast<uint32_t>(typeAndWaiters);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((seq & 1) != 0 || seq != seq_.load(std::memory_order_relaxed));
+        return seq != 0;
+    }
+
+private:
+    enum DataIndex { LOCK, SITE, WAIT_US, HOLD_US, IDLE_US, TYPE_AND_WAITERS, DATA_NUM };
+
+    std::atomic<uint32_t> seq_ {0};
+    std::atomic<uint64_t> data_[DATA_NUM] {};
+};
+
+struct LockSampleRing {
+    LockSampleSlot slots[RING_SLOT_NUM];
+    std::atomic<uint32_t> pos {0};
+    std::atomic<bool> inUse {false};
+};
+
+// rings are never freed, a ring left by an exited thread is taken over by the next thread that samples
+std::atomic<LockSampleRing*> g_rings[MAX_RING_NUM];
+std::atomic<uint32_t> g_ringNum {0};
+
+LockSampleRing* AcquireRing()
+{
+    uint32_t num = std::min(g_ringNum.load(std::memory_order_acquire), MAX_RING_NUM);
+    for (uint32_t i = 0; i < num; i++) {
+        LockSampleRing* ring = g_rings[i].load(std::memory_order_acquire);
+        bool expected = false;
+        if (ring != nullptr && ring->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return ring;
+        }
+    }
+    if (g_ringNum.load(std::memory_order_relaxed) >= MAX_RING_NUM) {
+        return nullptr;
+    }
+    uint32_t idx = g_ringNum.fetch_add(1, std::memory_order_relaxed);
+    if (idx >= MAX_RING_NUM) {
+        return nullptr;
+    }
+    auto ring = new (std::nothrow) LockSampleRing();
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    ring->inUse.store(true, std::memory_order_relaxed);
+    g_rings[idx].store(ring, std::memory_order_release);
+    return ring;
+}
+
+class RingHolder {
+public:
+    ~RingHolder()
+    {
+        if (ring_ != nullptr) {
+            ring_->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    LockSampleRing* Get()
+    {
+        if (!acquired_) {
+            acquired_ = true;
+            ring_ = AcquireRing();
+        }
+        return ring_;
+    }
+
+private:
+    LockSampleRing* ring_ = nullptr;
+    bool acquired_ = false;
+};
+
+void PushSample(const LockSample& sample)
+{
+    static thread_local RingHolder holder;
+    LockSampleRing* ring = holder.Get();
+    if (ring == nullptr) {
+        return;
+    }
+    uint32_t pos = ring->pos.load(std::memory_order_relaxed);
+    ring->slots[pos % RING_SLOT_NUM].Store(sample);
+    ring->pos.store(pos + 1, std::memory_order_release);
+}
+
+// an acquisition whose hold time is being measured, the fields belong to whoever moved lock to PENDING_BUSY
+struct PendingHold {
+    std::atomic<uintptr_t> lock {0};
+    uint64_t owner = 0;
+    uintptr_t site = 0;
+    uint64_t beginUs = 0;
+    ffrt::LockProfileType type = ffrt::LockProfileType::MUTEX;
+};
+
+PendingHold g_pendingHolds[PENDING_HOLD_NUM];
+
+inline PendingHold& PendingSlot(const void* lock)
+{
+    return g_pendingHolds[(reinterpret_cast<uintptr_t>(lock) >> PENDING_HOLD_ADDR_SHIFT) % PENDING_HOLD_NUM];
+}
+
+// the owner is the task rather than the thread, as a task may be resumed on another worker before unlocking
+inline uint64_t CurrentOwnerId()
+{
+    auto task = ffrt::ExecuteCtx::Cur()->task;
+    return task == nullptr ? GetTid() : (task->gid | TASK_OWNER_FLAG);
+}
+
+const char* TypeName(ffrt::LockProfileType type)
+{
+    switch (type) {
+        case ffrt::LockProfileType::MUTEX:
+            return "mutex";
+        case ffrt::LockProfileType::RWLOCK_WRITE:
+            return "rwlock_wr";
+        case ffrt::LockProfileType::RWLOCK_READ:
+            return "rwlock_rd";
+        case ffrt::LockProfileType::COND_WAIT:
+            return "cond";
+        default:
+            return "unknown";
+    }
+}
+
+std::string SiteName(uintptr_t site)
+{
+    std::ostringstream oss;
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(site), &info) != 0) {
+        if (info.dli_sname != nullptr) {
+            oss << info.dli_sname << "+0x" << std::hex << (site - reinterpret_cast<uintptr_t>(info.dli_saddr));
+            return oss.str();
+        }
+        if (info.dli_fname != nullptr) {
+            oss << info.dli_fname << "+0x" << std::hex << (site - reinterpret_cast<uintptr_t>(info.dli_fbase));
+            return oss.str();
+        }
+    }
+    oss << "0x" << std::hex << site;
+    return oss.str();
+}
+
+struct LockStat {
+    ffrt::LockProfileType type = ffrt::LockProfileType::MUTEX;
+    uint64_t waitNum = 0;
+    uint64_t waitTotal = 0;
+    uint64_t waitMax = 0;
+    uint64_t holdNum = 0;
+    uint64_t holdTotal = 0;
+    uint64_t holdMax = 0;
+    uint64_t idleNum = 0;
+    uint64_t idleTotal = 0;
+    uint64_t idleMax = 0;
+    uint32_t waitersMax = 0;
+};
+
+void AddSample(LockStat& stat, const LockSample& sample)
+{
+    stat.type = sample.type;
+    if (sample.waitUs != NOT_MEASURED) {
+        stat.waitNum++;
+        stat.waitTotal += sample.waitUs;
+        stat.waitMax = std::max(stat.waitMax, sample.waitUs);
+        stat.waitersMax = std::max(stat.waitersMax, sample.waiters);
+    }
+    if (sample.holdUs != NOT_MEASURED) {
+        stat.holdNum++;
+        stat.holdTotal += sample.holdUs;
+        stat.holdMax = std::max(stat.holdMax, sample.holdUs);
+    }
+    if (sample.idleUs != NOT_MEASURED) {
+        stat.idleNum++;
+        stat.idleTotal += sample.idleUs;
+        stat.idleMax = std::max(stat.idleMax, sample.idleUs);
+        stat.waitersMax = std::max(stat.waitersMax, sample.waiters);
+    }
+}
+} // namespace
+
+namespace ffrt {
+void LockProfiler::RecordWait(const void* lock, LockProfileType type, const void* site, uint64_t waitUs,
+    uint32_t waiters)
+{
+    LockSample sample;
+    sample.lock = reinterpret_cast<uintptr_t>(lock);
+    sample.site = reinterpret_cast<uintptr_t>(site);
+    sample.waitUs = waitUs;
+    sample.waiters = waiters;
+    sample.type = type;
+    PushSample(sample);
+}
+
+void LockProfiler::RecordIdle(const void* cond, const void* site, uint64_t idleUs, uint32_t waiters)
+{
+    LockSample sample;
+    sample.lock = reinterpret_cast<uintptr_t>(cond);
+    sample.site = reinterpret_cast<uintptr_t>(site);
+    sample.idleUs = idleUs;
+    sample.waiters = waiters;
+    sample.type = LockProfileType::COND_WAIT;
+    PushSample(sample);
+}
+
+void LockProfiler::BeginHold(const void* lock, LockProfileType type, const void* site, uint64_t beginUs)
+{
+    auto& slot = PendingSlot(lock);
+    uintptr_t addr = reinterpret_cast<uintptr_t>(lock);
+    uintptr_t expected = slot.lock.load(std::memory_order_relaxed);
+    // a pending entry of the same lock is stale, its owner released the lock without reporting the unlock
+    if ((expected != 0 && expected != addr) ||
+        !slot.lock.compare_exchange_strong(expected, PENDING_BUSY, std::memory_order_acquire,
+            std::memory_order_relaxed)) {
+        return;
+    }
+    slot.owner = CurrentOwnerId();
+    slot.site = reinterpret_cast<uintptr_t>(site);
+    slot.beginUs = beginUs;
+    slot.type = type;
+    slot.lock.store(addr, std::memory_order_release);
+    if (expected == 0) {
+        pendingHoldNum_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LockProfiler::EndHoldSlow(const void* lock)
+{
+    auto& slot = PendingSlot(lock);
+    uintptr_t addr = reinterpret_cast<uintptr_t>(lock);
+    uintptr_t expected = addr;
+    if (slot.lock.load(std::memory_order_relaxed) != addr ||
+        !slot.lock.compare_exchange_strong(expected, PENDING_BUSY, std::memory_order_acquire,
+            std::memory_order_relaxed)) {
+        return;
+    }
+    if (slot.owner != CurrentOwnerId()) {
+        slot.lock.store(addr, std::memory_order_release);
+        return;
+    }
+    LockSample sample;
+    sample.lock = addr;
+    sample.site = slot.site;
+    sample.type = slot.type;
+    sample.holdUs = TimeStampCntvct() - slot.beginUs;
+    slot.lock.store(0, std::memory_order_release);
+    pendingHoldNum_.fetch_sub(1, std::memory_order_relaxed);
+    PushSample(sample);
+}
+
+void LockProfiler::SetSampleRate(uint32_t rate)
+{
+    sampleRate_.store(rate, std::memory_order_relaxed);
+}
+
+uint32_t LockProfiler::GetSampleRate()
+{
+    return sampleRate_.load(std::memory_order_relaxed);
+}
+
+int LockProfiler::Dump(char* buf, uint32_t len)
+{
+    std::map<std::pair<uintptr_t, uintptr_t>, LockStat> stats;
+    uint32_t num = std::min(g_ringNum.load(std::memory_order_acquire), MAX_RING_NUM);
+    for (uint32_t i = 0; i < num; i++) {
+        LockSampleRing* ring = g_rings[i].load(std::memory_order_acquire);
+        if (ring == nullptr) {
+            continue;
+        }
+        for (uint32_t j = 0; j < RING_SLOT_NUM; j++) {
+            LockSample sample;
+            if (ring->slots[j].Load(sample)) {
+                AddSample(stats[{sample.lock, sample.site}], sample);
+            }
+        }
+    }
+
+    // the idle time of condition variable waits is listed apart, it is not contention on any lock
+    std::vector<std::pair<std::pair<uintptr_t, uintptr_t>, LockStat>> sorted;
+    std::vector<std::pair<std::pair<uintptr_t, uintptr_t>, LockStat>> idle;
+    for (const auto& entry : stats) {
+        if (entry.second.waitNum != 0 || entry.second.holdNum != 0) {
+            sorted.push_back(entry);
+        }
+        if (entry.second.idleNum != 0) {
+            idle.push_back(entry);
+        }
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.waitTotal != b.second.waitTotal ? a.second.waitTotal > b.second.waitTotal :
+            a.second.holdTotal > b.second.holdTotal;
+    });
+    if (sorted.size() > DUMP_TOP_NUM) {
+        sorted.resize(DUMP_TOP_NUM);
+    }
+    std::sort(idle.begin(), idle.end(), [](const auto& a, const auto& b) {
+        return a.second.idleTotal > b.second.idleTotal;
+    });
+    if (idle.size() > DUMP_TOP_NUM) {
+        idle.resize(DUMP_TOP_NUM);
+    }
+
+    std::ostringstream oss;
+    oss << "---\n" << "lock contention, sample rate 1/" << GetSampleRate() << "\n";
+    oss << "Lock Type WaitNum AvgWait(us) MaxWait(us) HoldNum AvgHold(us) MaxHold(us) MaxWaiters Site\n";
+    for (const auto& [key, stat] : sorted) {
+        oss << "0x" << std::hex << key.first << std::dec << " " << TypeName(stat.type) << " " << stat.waitNum << " " <<
+            (stat.waitNum == 0 ? 0 : stat.waitTotal / stat.waitNum) << " " << stat.waitMax << " " << stat.holdNum <<
+            " " << (stat.holdNum == 0 ? 0 : stat.holdTotal / stat.holdNum) << " " << stat.holdMax << " " <<
+            stat.waitersMax << " " << SiteName(key.second) << "\n";
+    }
+    oss << "condition wait idle\n";
+    oss << "Lock Type IdleNum AvgIdle(us) MaxIdle(us) MaxWaiters Site\n";
+    for (const auto& [key, stat] : idle) {
+        oss << "0x" << std::hex << key.first << std::dec << " " << TypeName(stat.type) << " " << stat.idleNum << " " <<
+            stat.idleTotal / stat.idleNum << " " << stat.idleMax << " " << stat.waitersMax << " " <<
+            SiteName(key.second) << "\n";
+    }
+    oss << "---\n";
+    return snprintf_s(buf, len, len - 1, "%s", oss.str().c_str());
+}
+} // namespace ffrt
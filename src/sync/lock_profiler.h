@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_LOCK_PROFILER_H
+#define FFRT_LOCK_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include "internal_inc/osal.h"
+#include "tm/task_base.h"
+#include "util/time_format.h"
+
+namespace ffrt {
+enum class LockProfileType : uint8_t {
+    MUTEX,
+    RWLOCK_WRITE,
+    RWLOCK_READ,
+    COND_WAIT,
+};
+
+/*
+ * Sampled contention profiler of the sync primitives, always on with a low default sample rate.
+ * One in every N lock calls of a thread is profiled; if that acquisition has to wait, the wait time, the number of
+ * waiters parked on the lock and the call site go to a per-thread ring, and the hold time follows at unlock.
+ */
+class LockProfiler {
+public:
+    static constexpr uint32_t DEFAULT_SAMPLE_RATE = 64;
+
+    static inline bool ShouldSample()
+    {
+        uint32_t rate = sampleRate_.load(std::memory_order_relaxed);
+        if (rate == 0) {
+            return false;
+        }
+        static thread_local uint32_t tick = 0;
+        if (++tick < rate) {
+            return false;
+        }
+        tick = 0;
+        return true;
+    }
+
+    /*
+     * waiterNum is the count of tasks and threads parked on the lock, kept by the lock through LockWaiterGuard.
+     * The hold time is only measured when the lock is released through a call that reports it with EndHold.
+     */
+    template <typename TryLockFunc, typename LockFunc>
+    static void ProfileLock(const void* lock, const std::atomic<uint32_t>& waiterNum, LockProfileType type,
+        const void* site, bool measureHold, TryLockFunc&& tryLock, LockFunc&& doLock)
+    {
+        if (tryLock()) {
+            return;
+        }
+        uint32_t waiters = waiterNum.load(std::memory_order_relaxed);
+        uint64_t begin = TimeStampCntvct();
+        doLock();
+        uint64_t end = TimeStampCntvct();
+        RecordWait(lock, type, site, end - begin, waiters);
+        if (measureHold) {
+            BeginHold(lock, type, site, end);
+        }
+    }
+
+    /*
+     * Profiles a condition variable wait, the lock is the condition variable.
+     * Waiting for a notify is idle time rather than contention, so it is recorded apart from the lock waits.
+     */
+    template <typename WaitFunc>
+    static int ProfileWait(const void* cond, const std::atomic<uint32_t>& waiterNum, const void* site,
+        WaitFunc&& doWait)
+    {
+        uint32_t waiters = waiterNum.load(std::memory_order_relaxed);
+        uint64_t begin = TimeStampCntvct();
+        int ret = doWait();
+        RecordIdle(cond, site, TimeStampCntvct() - begin, waiters);
+        return ret;
+    }
+
+    // ends the hold time measurement of a lock released by its current owner, if one is pending
+    static inline void EndHold(const void* lock)
+    {
+        if likely(pendingHoldNum_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        EndHoldSlow(lock);
+    }
+
+    static void RecordWait(const void* lock, LockProfileType type, const void* site, uint64_t waitUs,
+        uint32_t waiters);
+    static void RecordIdle(const void* cond, const void* site, uint64_t idleUs, uint32_t waiters);
+    static void SetSampleRate(uint32_t rate);
+    static uint32_t GetSampleRate();
+    static int Dump(char* buf, uint32_t len);
+
+private:
+    static void BeginHold(const void* lock, LockProfileType type, const void* site, uint64_t beginUs);
+    static void EndHoldSlow(const void* lock);
+
+    static inline std::atomic<uint32_t> sampleRate_ {DEFAULT_SAMPLE_RATE};
+    static inline std::atomic<uint32_t> pendingHoldNum_ {0};
+};
+
+// counts a task or thread parked on a lock in the waiter count of that lock, for every wait
+class LockWaiterGuard {
+public:
+    explicit LockWaiterGuard(std::atomic<uint32_t>& waiterNum) : waiterNum_(waiterNum)
+    {
+        waiterNum_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~LockWaiterGuard()
+    {
+        waiterNum_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    LockWaiterGuard(const LockWaiterGuard&) = delete;
+    LockWaiterGuard& operator=(const LockWaiterGuard&) = delete;
+
+private:
+    std::atomic<uint32_t>& waiterNum_;
+};
+} // namespace ffrt
+#endif // FFRT_LOCK_PROFILER_H
@@ -26,11 +26,57 @@
 #include "internal_inc/osal.h"
 #include "internal_inc/types.h"
 #include "sync/mutex_private.h"
+#include "sync/lock_profiler.h"
 #include "dfx/log/ffrt_log_api.h"
 #include "dfx/trace/ffrt_trace.h"
 #include "tm/cpu_task.h"
+#include "util/time_format.h"
+
+namespace {
+constexpr uint32_t MIN_SPIN_COUNT = 16;
+constexpr uint32_t MAX_SPIN_COUNT = 1024;
+constexpr uint32_t SPIN_ESTIMATE_SHIFT = 3; // the estimate moves 1/8 of the way towards the last spin count
+constexpr uint64_t MUTEX_STARVATION_THRESHOLD_US = 1000;
+constexpr long MUTEX_TYPE_MASK = 0xff;
+constexpr long MUTEX_FAIR_FLAG = 0x100;
+
+inline bool IsMultiCore()
+{
+    static const bool multiCore = sysconf(_SC_NPROCESSORS_ONLN) > 1;
+    return multiCore;
+}
+} // namespace
 
 namespace ffrt {
+bool mutexPrivate::spin_lock()
+{
+    // spinning only pays off when the owner runs on another core
+    if (!IsMultiCore()) {
+        return false;
+    }
+
+    uint32_t last = spinEstimate.load(std::memory_order_relaxed);
+    uint32_t maxSpin = std::min(MAX_SPIN_COUNT, last * 2 + MIN_SPIN_COUNT);
+    uint32_t cnt = 0;
+    bool locked = false;
+    for (; cnt < maxSpin; ++cnt) {
+        int v = l.load(std::memory_order_relaxed);
+        // someone already parked, the owner holds the lock for long, stop spinning to avoid a convoy
+        if (v == sync_detail::WAIT) {
+            break;
+        }
+        if (v == sync_detail::UNLOCK &&
+            l.compare_exchange_weak(v, sync_detail::LOCK, std::memory_order_acquire, std::memory_order_relaxed)) {
+            locked = true;
+            break;
+        }
+        spin();
+    }
+    int32_t delta = (static_cast<int32_t>(cnt) - static_cast<int32_t>(last)) / (1 << SPIN_ESTIMATE_SHIFT);
+    spinEstimate.store(static_cast<uint32_t>(static_cast<int32_t>(last) + delta), std::memory_order_relaxed);
+    return locked;
+}
+
 bool mutexPrivate::try_lock()
 {
     int v = sync_detail::UNLOCK;
@@ -63,6 +109,9 @@ void mutexPrivate::lock()
     if (l.compare_exchange_strong(v, sync_detail::LOCK, std::memory_order_acquire, std::memory_order_relaxed)) {
         goto lock_out;
     }
+    if (spin_lock()) {
+        goto lock_out;
+    }
     if (l.load(std::memory_order_relaxed) == sync_detail::WAIT) {
         wait();
     }
@@ -77,129 +126,96 @@ lock_out:
     return;
 }
 
-bool RecursiveMutexPrivate::try_lock()
+bool mutexPrivate::try_lock_until(const TimePoint& tp)
 {
-    auto ctx = ExecuteCtx::Cur();
-    auto task = ctx->task;
-    if ((!USE_COROUTINE) || (task == nullptr)) {
-        fMutex.lock();
-        if (taskLockNums.first == UINT64_MAX) {
-            fMutex.unlock();
-            if (mt.try_lock()) {
-                fMutex.lock();
-                taskLockNums = std::make_pair(GetTid(), 1);
-                fMutex.unlock();
-                return true;
-            } else {
+    if (try_lock()) {
+        return true;
+    }
+    if (!spin_lock()) {
+        LockWaiterGuard guard(waiterNum);
+        while (l.exchange(sync_detail::WAIT, std::memory_order_acquire) != sync_detail::UNLOCK) {
+            wlock.lock();
+            if (l.load(std::memory_order_relaxed) != sync_detail::WAIT) {
+                wlock.unlock();
+                continue;
+            }
+            // on timeout the lock word is left as WAIT, which only costs the owner a call to wake()
+            if (!TimedPark(wlock, tp, [this](WaitEntry& we) {
+                list.PushBack(we.node);
+                return &we.node;
+            })) {
                 return false;
             }
         }
-
-        if (taskLockNums.first == GetTid()) {
-            taskLockNums.second += 1;
-            fMutex.unlock();
-            return true;
-        }
-
-        fMutex.unlock();
-        return false;
     }
+#ifdef FFRT_MUTEX_DEADLOCK_CHECK
+    uint64_t task = ExecuteCtx::Cur()->task ? reinterpret_cast<uint64_t>(ExecuteCtx::Cur()->task) : GetTid();
+    MutexGraph::Instance().AddNode(task, 0, false);
+    owner.store(task, std::memory_order_relaxed);
+#endif
+    return true;
+}
 
-    fMutex.lock();
-    if (taskLockNums.first == UINT64_MAX) {
-        fMutex.unlock();
-        if (mt.try_lock()) {
-            fMutex.lock();
-            taskLockNums = std::make_pair(task->gid | 0x8000000000000000, 1);
-            fMutex.unlock();
-            return true;
-        } else {
-            return false;
-        }
+uint64_t RecursiveMutexPrivate::GetOwnerId()
+{
+    auto task = ExecuteCtx::Cur()->task;
+    if ((!USE_COROUTINE) || (task == nullptr)) {
+        return GetTid();
     }
+    return task->gid | 0x8000000000000000;
+}
 
-    if (taskLockNums.first == (task->gid | 0x8000000000000000)) {
-        taskLockNums.second += 1;
-        fMutex.unlock();
+bool RecursiveMutexPrivate::try_lock()
+{
+    uint64_t id = GetOwnerId();
+    if (owner.load(std::memory_order_relaxed) == id) {
+        lockNum++;
         return true;
     }
-
-    fMutex.unlock();
-    return false;
+    if (!mt.try_lock()) {
+        return false;
+    }
+    owner.store(id, std::memory_order_relaxed);
+    lockNum = 1;
+    return true;
 }
 
-void RecursiveMutexPrivate::lock()
+bool RecursiveMutexPrivate::try_lock_until(const TimePoint& tp)
 {
-    auto ctx = ExecuteCtx::Cur();
-    auto task = ctx->task;
-    if ((!USE_COROUTINE) || (task == nullptr)) {
-        fMutex.lock();
-        if (taskLockNums.first != GetTid()) {
-            fMutex.unlock();
-            mt.lock();
-            fMutex.lock();
-            taskLockNums = std::make_pair(GetTid(), 1);
-            fMutex.unlock();
-            return;
-        }
-
-        taskLockNums.second += 1;
-        fMutex.unlock();
-        return;
+    uint64_t id = GetOwnerId();
+    if (owner.load(std::memory_order_relaxed) == id) {
+        lockNum++;
+        return true;
     }
-
-    fMutex.lock();
-    if (taskLockNums.first != (task->gid | 0x8000000000000000)) {
-        fMutex.unlock();
-        mt.lock();
-        fMutex.lock();
-        taskLockNums = std::make_pair(task->gid | 0x8000000000000000, 1);
-        fMutex.unlock();
-        return;
+    if (!mt.try_lock_until(tp)) {
+        return false;
     }
-
-    taskLockNums.second += 1;
-    fMutex.unlock();
+    owner.store(id, std::memory_order_relaxed);
+    lockNum = 1;
+    return true;
 }
 
-void RecursiveMutexPrivate::unlock()
+void RecursiveMutexPrivate::lock()
 {
-    auto ctx = ExecuteCtx::Cur();
-    auto task = ctx->task;
-    if ((!USE_COROUTINE) || (task == nullptr)) {
-        fMutex.lock();
-        if (taskLockNums.first != GetTid()) {
-            fMutex.unlock();
-            return;
-        }
-
-        if (taskLockNums.second == 1) {
-            taskLockNums = std::make_pair(UINT64_MAX, 0);
-            fMutex.unlock();
-            mt.unlock();
-            return;
-        }
-
-        taskLockNums.second -= 1;
-        fMutex.unlock();
+    uint64_t id = GetOwnerId();
+    if (owner.load(std::memory_order_relaxed) == id) {
+        lockNum++;
         return;
     }
+    mt.lock();
+    owner.store(id, std::memory_order_relaxed);
+    lockNum = 1;
+}
 
-    fMutex.lock();
-    if (taskLockNums.first != (task->gid | 0x8000000000000000)) {
-        fMutex.unlock();
+void RecursiveMutexPrivate::unlock()
+{
+    if (owner.load(std::memory_order_relaxed) != GetOwnerId()) {
         return;
     }
-
-    if (taskLockNums.second == 1) {
-        taskLockNums = std::make_pair(UINT64_MAX, 0);
-        fMutex.unlock();
+    if (--lockNum == 0) {
+        owner.store(NO_OWNER, std::memory_order_relaxed);
         mt.unlock();
-        return;
     }
-
-    taskLockNums.second -= 1;
-    fMutex.unlock();
 }
 
 void mutexPrivate::unlock()
@@ -215,8 +231,39 @@ void mutexPrivate::unlock()
     }
 }
 
+bool mutexPrivate::requeue(WaitEntry* we)
+{
+    wlock.lock();
+    int v = l.load(std::memory_order_relaxed);
+    while (v != sync_detail::UNLOCK) {
+        // marking the lock word as WAIT makes the owner call wake() on unlock, which takes wlock after the push
+        if (v == sync_detail::WAIT ||
+            l.compare_exchange_weak(v, sync_detail::WAIT, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            list.PushBack(we->node);
+            wlock.unlock();
+            return true;
+        }
+    }
+    wlock.unlock();
+    return false;
+}
+
+void mutexPrivate::lock_requeued()
+{
+    // like a waiter woken in lock(), keep the lock word as WAIT so that the remaining waiters are woken in turn
+    while (l.exchange(sync_detail::WAIT, std::memory_order_acquire) != sync_detail::UNLOCK) {
+        wait();
+    }
+#ifdef FFRT_MUTEX_DEADLOCK_CHECK
+    uint64_t task = ExecuteCtx::Cur()->task ? reinterpret_cast<uint64_t>(ExecuteCtx::Cur()->task) : GetTid();
+    MutexGraph::Instance().AddNode(task, 0, false);
+    owner.store(task, std::memory_order_relaxed);
+#endif
+}
+
 void mutexPrivate::wait()
 {
+    LockWaiterGuard guard(waiterNum);
     auto ctx = ExecuteCtx::Cur();
     auto task = ctx->task;
     if (task == nullptr || task->Block() == BlockType::BLOCK_THREAD) {
@@ -228,11 +275,12 @@ void mutexPrivate::wait()
             }
             return;
         }
+        ctx->wn.woken = false;
         list.PushBack(ctx->wn.node);
         std::unique_lock<std::mutex> lk(ctx->wn.wl);
         ctx->wn.task = task;
         wlock.unlock();
-        ctx->wn.cv.wait(lk);
+        ctx->wn.cv.wait(lk, [ctx] { return ctx->wn.woken; });
         ctx->wn.task = nullptr;
         if (task) {
             task->Wake();
@@ -271,12 +319,111 @@ void mutexPrivate::wake()
         WaitUntilEntry* wue = static_cast<WaitUntilEntry*>(we);
         std::lock_guard lk(wue->wl);
         wlock.unlock();
+        wue->woken = true;
         wue->cv.notify_one();
     } else {
         wlock.unlock();
         CoWake(static_cast<CoTask*>(task), CoWakeType::NO_TIMEOUT_WAKE);
     }
 }
+
+bool FairMutexPrivate::try_lock()
+{
+    int v = sync_detail::UNLOCK;
+    return l.compare_exchange_strong(v, sync_detail::LOCK, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void FairMutexPrivate::lock()
+{
+    FFRT_PERF_TRACE_SCOPED_BY_GROUP(SYNC, Mutex_Lock, DEFAULT_CONFIG);
+    int v = sync_detail::UNLOCK;
+    if (l.compare_exchange_strong(v, sync_detail::LOCK, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return;
+    }
+
+    Waiter waiter;
+    waiter.waitStart = TimeStampCntvct();
+    bool requeue = false;
+    while (l.exchange(sync_detail::WAIT, std::memory_order_acquire) != sync_detail::UNLOCK) {
+        if (wait(waiter, requeue)) {
+            // ownership is handed over by unlock, the lock word is kept as WAIT
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return;
+        }
+        // a waiter losing the race after wakeup keeps its place at the head of the list
+        requeue = waiter.woken;
+    }
+}
+
+bool FairMutexPrivate::try_lock_until(const TimePoint& tp)
+{
+    int v = sync_detail::UNLOCK;
+    if (l.compare_exchange_strong(v, sync_detail::LOCK, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return true;
+    }
+
+    LockWaiterGuard guard(waiterNum);
+    Waiter waiter;
+    waiter.waitStart = TimeStampCntvct();
+    bool requeue = false;
+    while (l.exchange(sync_detail::WAIT, std::memory_order_acquire) != sync_detail::UNLOCK) {
+        wlock.lock();
+        if (l.load(std::memory_order_relaxed) != sync_detail::WAIT) {
+            wlock.unlock();
+            continue;
+        }
+        waiter.ctx = ExecuteCtx::Cur();
+        waiter.task = waiter.ctx->task;
+        waiter.woken = false;
+        bool woken = TimedPark(wlock, tp, [this, &waiter, requeue](WaitEntry& we) {
+            waiter.threadWait = (&we == &waiter.ctx->wn);
+            requeue ? list.PushFront(waiter.node) : list.PushBack(waiter.node);
+            return &waiter.node;
+        });
+        if (!woken) {
+            return false;
+        }
+        if (waiter.handoff) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+        requeue = true;
+    }
+    return true;
+}
+
+void FairMutexPrivate::unlock()
+{
+    FFRT_PERF_TRACE_SCOPED_BY_GROUP(SYNC, Mutex_UnLock, DEFAULT_CONFIG);
+    int v = sync_detail::LOCK;
+    if (l.compare_exchange_strong(v, sync_detail::UNLOCK, std::memory_order_release, std::memory_order_relaxed)) {
+        return;
+    }
+
+    wlock.lock();
+    Waiter* waiter = static_cast<Waiter*>(list.PopFront(&ParkEntry::node));
+    if (waiter == nullptr) {
+        l.store(sync_detail::UNLOCK, std::memory_order_release);
+        wlock.unlock();
+        return;
+    }
+    if (TimeStampCntvct() - waiter->waitStart >= MUTEX_STARVATION_THRESHOLD_US) {
+        waiter->handoff = true;
+        std::atomic_thread_fence(std::memory_order_release);
+    } else {
+        l.store(sync_detail::UNLOCK, std::memory_order_release);
+    }
+    ParkWake(wlock, waiter);
+}
+
+bool FairMutexPrivate::wait(Waiter& waiter, bool requeue)
+{
+    LockWaiterGuard guard(waiterNum);
+    ParkWait(wlock, waiter, [this] { return l.load(std::memory_order_relaxed) != sync_detail::WAIT; },
+        [this, requeue](ParkEntry& entry) { requeue ? list.PushFront(entry.node) : list.PushBack(entry.node); },
+        [](uint64_t gid) { FFRT_BLOCK_TRACER(gid, mtx); });
+    return waiter.handoff;
+}
 } // namespace ffrt
 
 #ifdef __cplusplus
@@ -304,7 +451,7 @@ int ffrt_mutexattr_settype(ffrt_mutexattr_t* attr, int type)
         FFRT_LOGE("mutex type is invaild");
         return ffrt_error_inval;
     }
-    attr->storage = static_cast<long>(type);
+    attr->storage = (attr->storage & MUTEX_FAIR_FLAG) | static_cast<long>(type);
     return ffrt_success;
 }
 
@@ -315,7 +462,29 @@ int ffrt_mutexattr_gettype(ffrt_mutexattr_t* attr, int* type)
         FFRT_LOGE("attr or type should not be empty");
         return ffrt_error_inval;
     }
-    *type = static_cast<int>(attr->storage);
+    *type = static_cast<int>(attr->storage & MUTEX_TYPE_MASK);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_mutexattr_setfair(ffrt_mutexattr_t* attr, bool fair)
+{
+    if (attr == nullptr) {
+        FFRT_LOGE("attr should not be empty");
+        return ffrt_error_inval;
+    }
+    attr->storage = fair ? (attr->storage | MUTEX_FAIR_FLAG) : (attr->storage & ~MUTEX_FAIR_FLAG);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_mutexattr_getfair(const ffrt_mutexattr_t* attr, bool* fair)
+{
+    if (attr == nullptr || fair == nullptr) {
+        FFRT_LOGE("attr or fair should not be empty");
+        return ffrt_error_inval;
+    }
+    *fair = (attr->storage & MUTEX_FAIR_FLAG) != 0;
     return ffrt_success;
 }
 
@@ -341,12 +510,18 @@ int ffrt_mutex_init(ffrt_mutex_t* mutex, const ffrt_mutexattr_t* attr)
         "size must be less than ffrt_mutex_storage_size");
         new (mutex)ffrt::mutexPrivate();
         return ffrt_success;
+    } else if (attr->storage == (static_cast<long>(ffrt_mutex_normal) | MUTEX_FAIR_FLAG)) {
+        static_assert(sizeof(ffrt::FairMutexPrivate) <= ffrt_mutex_storage_size,
+        "size must be less than ffrt_mutex_storage_size");
+        new (mutex)ffrt::FairMutexPrivate();
+        return ffrt_success;
     } else if (attr->storage == static_cast<uint64_t>(ffrt_mutex_recursive)) {
         static_assert(sizeof(ffrt::RecursiveMutexPrivate) <= ffrt_mutex_storage_size,
         "size must be less than ffrt_mutex_storage_size");
         new (mutex)ffrt::RecursiveMutexPrivate();
         return ffrt_success;
     }
+    FFRT_LOGE("mutex attr is invalid, only normal mutexes can be fair");
     return ffrt_error_inval;
 }
 
@@ -358,6 +533,11 @@ int ffrt_mutex_lock(ffrt_mutex_t* mutex)
         return ffrt_error_inval;
     }
     auto p = reinterpret_cast<ffrt::mutexBase*>(mutex);
+    if unlikely(ffrt::LockProfiler::ShouldSample()) {
+        ffrt::LockProfiler::ProfileLock(p, p->waiter_num(), ffrt::LockProfileType::MUTEX,
+            __builtin_return_address(0), true, [p] { return p->try_lock(); }, [p] { p->lock(); });
+        return ffrt_success;
+    }
     p->lock();
     return ffrt_success;
 }
@@ -369,6 +549,7 @@ int ffrt_mutex_unlock(ffrt_mutex_t* mutex)
         MutexEmptyLogPrint();
         return ffrt_error_inval;
     }
+    ffrt::LockProfiler::EndHold(mutex);
     auto p = reinterpret_cast<ffrt::mutexBase*>(mutex);
     p->unlock();
     return ffrt_success;
@@ -381,7 +562,17 @@ int ffrt_mutex_lock_wait(ffrt_mutex_t* mutex)
         MutexEmptyLogPrint();
         return ffrt_error_inval;
     }
-    reinterpret_cast<ffrt::mutexPrivate*>(mutex)->lock_slow();
+    auto p = reinterpret_cast<ffrt::mutexPrivate*>(mutex);
+    if unlikely(ffrt::LockProfiler::ShouldSample()) {
+        /*
+         * The inline fast path of the caller has already failed, so the acquisition is contended.
+         * Its hold is not measured, as the inline unlock does not report the release unless there are waiters.
+         */
+        ffrt::LockProfiler::ProfileLock(p, p->waiter_num(), ffrt::LockProfileType::MUTEX,
+            __builtin_return_address(0), false, [] { return false; }, [p] { p->lock_slow(); });
+        return ffrt_success;
+    }
+    p->lock_slow();
     return ffrt_success;
 }
 
@@ -407,6 +598,18 @@ int ffrt_mutex_trylock(ffrt_mutex_t* mutex)
     return p->try_lock() ? ffrt_success : ffrt_error_busy;
 }
 
+API_ATTRIBUTE((visibility("default")))
+int ffrt_mutex_timedlock(ffrt_mutex_t* mutex, const struct timespec* time_point)
+{
+    if unlikely(!mutex) {
+        MutexEmptyLogPrint();
+        return ffrt_error_inval;
+    }
+    FFRT_COND_DO_ERR((time_point == nullptr), return ffrt_error_inval, "time_point should not be empty");
+    auto p = reinterpret_cast<ffrt::mutexBase*>(mutex);
+    return p->try_lock_until(ffrt::ToTimePoint(*time_point)) ? ffrt_success : ffrt_error_timedout;
+}
+
 API_ATTRIBUTE((visibility("default")))
 int ffrt_mutex_destroy(ffrt_mutex_t* mutex)
 {
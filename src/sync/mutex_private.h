@@ -115,21 +115,33 @@ public:
     virtual void lock() {}
     virtual void unlock() {}
     virtual bool try_lock() { return false; }
+    // waits for the mutex until tp, both on its wait list and on the DelayedWorker, see TimedPark
+    virtual bool try_lock_until(const TimePoint&) { return false; }
+    // moves a waiter woken by a condition variable to the wait list of the held mutex, see WaitQueue::Notify
+    virtual bool requeue(WaitEntry*) { return false; }
+    // the count of tasks and threads parked on the mutex, read by the lock profiler
+    virtual const std::atomic<uint32_t>& waiter_num() const = 0;
 };
 
 class mutexPrivate : public mutexBase {
     std::atomic<int> l = sync_detail::UNLOCK;
+    std::atomic<uint32_t> waiterNum {0};
 #ifdef FFRT_MUTEX_DEADLOCK_CHECK
     std::atomic<uintptr_t> owner;
 #endif
     fast_mutex wlock;
+    std::atomic<uint32_t> spinEstimate {0}; // learned spin count of this mutex, fills the padding after wlock
     LinkedList list;
 
     void wait();
+    bool spin_lock();
 public:
     void wake();
     FFRT_INLINE void lock_slow()
     {
+        if (spin_lock()) {
+            return;
+        }
         if (l.load(std::memory_order_relaxed) == sync_detail::WAIT) {
             wait();
         }
@@ -147,8 +159,43 @@ public:
     void operator = (mutexPrivate const &) = delete;
 
     bool try_lock() override;
+    bool try_lock_until(const TimePoint& tp) override;
+    void lock() override;
+    void unlock() override;
+    bool requeue(WaitEntry* we) override;
+    const std::atomic<uint32_t>& waiter_num() const override { return waiterNum; }
+    // acquires the mutex after being woken from its wait list, in place of lock()
+    void lock_requeued();
+};
+
+/*
+ * Normal mutex with anti-starvation: once the longest waiter has waited for more than a threshold,
+ * unlock hands the ownership to it directly instead of releasing the lock for anyone to barge in.
+ */
+class FairMutexPrivate : public mutexBase {
+public:
+    FairMutexPrivate() = default;
+    FairMutexPrivate(FairMutexPrivate const&) = delete;
+    void operator = (FairMutexPrivate const&) = delete;
+
+    bool try_lock() override;
+    bool try_lock_until(const TimePoint& tp) override;
     void lock() override;
     void unlock() override;
+    const std::atomic<uint32_t>& waiter_num() const override { return waiterNum; }
+
+private:
+    struct Waiter : ParkEntry {
+        bool handoff = false;
+        uint64_t waitStart = 0;
+    };
+
+    bool wait(Waiter& waiter, bool requeue);
+
+    std::atomic<int> l = sync_detail::UNLOCK;
+    std::atomic<uint32_t> waiterNum {0};
+    fast_mutex wlock;
+    LinkedList list;
 };
 
 class RecursiveMutexPrivate : public mutexBase {
@@ -156,6 +203,8 @@ public:
     void lock() override;
     void unlock() override;
     bool try_lock() override;
+    bool try_lock_until(const TimePoint& tp) override;
+    const std::atomic<uint32_t>& waiter_num() const override { return mt.waiter_num(); }
 
     RecursiveMutexPrivate() = default;
     ~RecursiveMutexPrivate() = default;
@@ -163,8 +212,12 @@ public:
     void operator = (RecursiveMutexPrivate const&) = delete;
 
 private:
-    std::pair<uint64_t, uint32_t> taskLockNums = std::make_pair(UINT64_MAX, 0);
-    fast_mutex fMutex;
+    static constexpr uint64_t NO_OWNER = UINT64_MAX;
+    static uint64_t GetOwnerId();
+
+    // owner is only set by the thread or task holding mt, so reading back its own id proves ownership
+    std::atomic<uint64_t> owner = NO_OWNER;
+    uint32_t lockNum = 0; // only accessed by the owner
     mutexPrivate mt;
 };
 
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync/semaphore_private.h"
+#include "c/semaphore.h"
+#include "dfx/log/ffrt_log_api.h"
+#include "dfx/trace/ffrt_trace.h"
+#include "internal_inc/osal.h"
+
+namespace ffrt {
+void ParkList::Park(const std::function<bool()>& ready)
+{
+    ParkEntry entry;
+    ParkWait(lock, entry, ready, [this](ParkEntry& e) { list.PushBack(e.node); },
+        [](uint64_t gid) { FFRT_BLOCK_TRACER(gid, prk); });
+}
+
+void ParkList::Unpark(uint32_t num)
+{
+    for (; num > 0; num--) {
+        lock.lock();
+        ParkEntry* entry = list.PopFront(&ParkEntry::node);
+        if (entry == nullptr) {
+            lock.unlock();
+            return;
+        }
+        ParkWake(lock, entry);
+    }
+}
+
+bool SemaphorePrivate::TryAcquire()
+{
+    int64_t v = count.load(std::memory_order_relaxed);
+    while (v > 0) {
+        if (count.compare_exchange_weak(v, v - 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SemaphorePrivate::Acquire()
+{
+    if (TryAcquire()) {
+        return;
+    }
+    // pairs with Release: either the waiter sees the new permits, or the releaser sees the waiter
+    waiterNum.fetch_add(1, std::memory_order_seq_cst);
+    while (!TryAcquire()) {
+        parkList.Park([this] { return count.load(std::memory_order_seq_cst) > 0; });
+    }
+    waiterNum.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void SemaphorePrivate::Release(uint32_t n)
+{
+    parkList.EnterWake();
+    count.fetch_add(n, std::memory_order_seq_cst);
+    if (waiterNum.load(std::memory_order_seq_cst) > 0) {
+        parkList.Unpark(n);
+    }
+    parkList.ExitWake();
+}
+} // namespace ffrt
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+API_ATTRIBUTE((visibility("default")))
+int ffrt_sem_init(ffrt_sem_t* sem, uint32_t value)
+{
+    FFRT_COND_DO_ERR((sem == nullptr), return ffrt_error_inval, "sem should not be empty");
+    static_assert(sizeof(ffrt::SemaphorePrivate) <= ffrt_sem_storage_size,
+        "size must be less than ffrt_sem_storage_size");
+
+    new (sem) ffrt::SemaphorePrivate(value);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_sem_post(ffrt_sem_t* sem, uint32_t count)
+{
+    FFRT_COND_DO_ERR((sem == nullptr), return ffrt_error_inval, "sem should not be empty");
+    reinterpret_cast<ffrt::SemaphorePrivate*>(sem)->Release(count);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_sem_wait(ffrt_sem_t* sem)
+{
+    FFRT_COND_DO_ERR((sem == nullptr), return ffrt_error_inval, "sem should not be empty");
+    reinterpret_cast<ffrt::SemaphorePrivate*>(sem)->Acquire();
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_sem_trywait(ffrt_sem_t* sem)
+{
+    FFRT_COND_DO_ERR((sem == nullptr), return ffrt_error_inval, "sem should not be empty");
+    return reinterpret_cast<ffrt::SemaphorePrivate*>(sem)->TryAcquire() ? ffrt_success : ffrt_error_busy;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_sem_destroy(ffrt_sem_t* sem)
+{
+    FFRT_COND_DO_ERR((sem == nullptr), return ffrt_error_inval, "sem should not be empty");
+    reinterpret_cast<ffrt::SemaphorePrivate*>(sem)->~SemaphorePrivate();
+    return ffrt_success;
+}
+#ifdef __cplusplus
+}
+#endif
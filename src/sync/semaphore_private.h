@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FFRT_SEMAPHORE_PRIVATE_H
+#define FFRT_SEMAPHORE_PRIVATE_H
+
+#include <atomic>
+#include <functional>
+#include "sync/sync.h"
+
+namespace ffrt {
+/*
+ * Wait list shared by the semaphore, latch and barrier. The primitives keep their state in atomics and only
+ * come here to suspend or wake up, so the uncontended paths never take the list lock.
+ */
+class ParkList {
+public:
+    // suspends the current task or thread until Unpark, unless ready() holds under the list lock
+    void Park(const std::function<bool()>& ready);
+    void Unpark(uint32_t num);
+    void UnparkAll()
+    {
+        Unpark(UINT32_MAX);
+    }
+
+    // a woken waiter may destroy the primitive while the waker is still inside it, destroy waits for the wakers
+    void EnterWake()
+    {
+        wakers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ExitWake()
+    {
+        wakers.fetch_sub(1, std::memory_order_release);
+    }
+
+    void WaitWakersDone() const
+    {
+        while (wakers.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    std::atomic<uint32_t> wakers {0};
+    fast_mutex lock;
+    LinkedList list;
+};
+
+class SemaphorePrivate {
+public:
+    explicit SemaphorePrivate(uint32_t value) : count(value) {}
+    ~SemaphorePrivate()
+    {
+        parkList.WaitWakersDone();
+    }
+    SemaphorePrivate(SemaphorePrivate const&) = delete;
+    void operator = (SemaphorePrivate const&) = delete;
+
+    bool TryAcquire();
+    void Acquire();
+    void Release(uint32_t n);
+
+private:
+    std::atomic<int64_t> count;
+    std::atomic<uint32_t> waiterNum {0};
+    ParkList parkList;
+};
+
+class LatchPrivate {
+public:
+    explicit LatchPrivate(uint32_t count) : count(count) {}
+    ~LatchPrivate()
+    {
+        parkList.WaitWakersDone();
+    }
+    LatchPrivate(LatchPrivate const&) = delete;
+    void operator = (LatchPrivate const&) = delete;
+
+    void CountDown(uint32_t n);
+    bool TryWait() const
+    {
+        return count.load(std::memory_order_acquire) == 0;
+    }
+    void Wait();
+
+private:
+    std::atomic<int64_t> count;
+    ParkList parkList;
+};
+
+class BarrierPrivate {
+public:
+    explicit BarrierPrivate(uint32_t count) : expected(count), remaining(count) {}
+    ~BarrierPrivate()
+    {
+        parkList.WaitWakersDone();
+    }
+    BarrierPrivate(BarrierPrivate const&) = delete;
+    void operator = (BarrierPrivate const&) = delete;
+
+    void ArriveAndWait();
+    void ArriveAndDrop()
+    {
+        Arrive(true);
+    }
+
+private:
+    uint64_t Arrive(bool drop);
+
+    std::atomic<uint64_t> phase {0};
+    std::atomic<int64_t> expected;
+    std::atomic<int64_t> remaining;
+    ParkList parkList;
+};
+} // namespace ffrt
+#endif
@@ -14,16 +14,58 @@
  */
 
 #include "shared_mutex_private.h"
+#include <unistd.h>
+#include "c/shared_mutex_ext.h"
 #include "dfx/log/ffrt_log_api.h"
 #include "dfx/trace/ffrt_trace.h"
 
 #include "internal_inc/osal.h"
 #include "internal_inc/types.h"
 #include "tm/cpu_task.h"
+#include "sync/lock_profiler.h"
+
+namespace {
+constexpr uint32_t MAX_READER_SLOT_NUM = 64;
+// the attribute is 0 for a normal rwlock and 2 for a read-biased one, any other value is invalid
+constexpr long RWLOCK_ATTR_NORMAL = 0;
+constexpr long RWLOCK_ATTR_READ_BIASED = 2;
+
+uint32_t GetReaderSlotNum()
+{
+    static const uint32_t slotNum = [] {
+        long cpuNum = sysconf(_SC_NPROCESSORS_CONF);
+        uint32_t num = 1;
+        while (num < cpuNum && num < MAX_READER_SLOT_NUM) {
+            num <<= 1;
+        }
+        return num;
+    }();
+    return slotNum;
+}
+
+// each thread keeps one slot, spread over the slots in the order threads first take a read lock
+uint32_t GetThreadSlotIndex()
+{
+    static std::atomic<uint32_t> nextIdx = 0;
+    return nextIdx.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace
 
 namespace ffrt {
+SharedMutexPrivate::SharedMutexPrivate(bool readBiased)
+{
+    if (readBiased) {
+        slotNum = GetReaderSlotNum();
+        slots = std::make_unique<ReaderSlot[]>(slotNum);
+    }
+}
+
 void SharedMutexPrivate::Lock()
 {
+    if (slots) {
+        ReadBiasedLock();
+        return;
+    }
     std::lock_guard lg(mut);
     while (state & writeEntered) {
         Wait(wList1, SharedMutexWaitType::WRITE);
@@ -36,6 +78,9 @@ void SharedMutexPrivate::Lock()
 
 bool SharedMutexPrivate::TryLock()
 {
+    if (slots) {
+        return ReadBiasedTryLock();
+    }
     std::lock_guard lg(mut);
     if (state == 0) {
         state = writeEntered;
@@ -44,8 +89,35 @@ bool SharedMutexPrivate::TryLock()
     return false;
 }
 
+bool SharedMutexPrivate::TryLockUntil(const TimePoint& tp)
+{
+    if (slots) {
+        return ReadBiasedTryLockUntil(tp);
+    }
+    std::lock_guard lg(mut);
+    while (state & writeEntered) {
+        if (!WaitUntil(wList1, SharedMutexWaitType::WRITE, tp)) {
+            return false;
+        }
+    }
+    state |= writeEntered;
+    while (state & readersMax) {
+        if (!WaitUntil(wList2, SharedMutexWaitType::NORMAL, tp)) {
+            // withdraw the write intent, which holds back new readers and writers
+            state &= ~writeEntered;
+            NotifyAll(wList1);
+            return false;
+        }
+    }
+    return true;
+}
+
 void SharedMutexPrivate::LockShared()
 {
+    if (slots) {
+        ReadBiasedLockShared();
+        return;
+    }
     std::lock_guard lg(mut);
     while (state >= readersMax) {
         Wait(wList1, SharedMutexWaitType::READ);
@@ -55,6 +127,9 @@ void SharedMutexPrivate::LockShared()
 
 bool SharedMutexPrivate::TryLockShared()
 {
+    if (slots) {
+        return ReadBiasedTryLockShared();
+    }
     std::lock_guard lg(mut);
     if (state < readersMax) {
         ++state;
@@ -63,8 +138,27 @@ bool SharedMutexPrivate::TryLockShared()
     return false;
 }
 
+bool SharedMutexPrivate::TryLockSharedUntil(const TimePoint& tp)
+{
+    if (slots) {
+        return ReadBiasedTryLockSharedUntil(tp);
+    }
+    std::lock_guard lg(mut);
+    while (state >= readersMax) {
+        if (!WaitUntil(wList1, SharedMutexWaitType::READ, tp)) {
+            return false;
+        }
+    }
+    ++state;
+    return true;
+}
+
 void SharedMutexPrivate::Unlock()
 {
+    if (slots) {
+        ReadBiasedUnlock();
+        return;
+    }
     std::lock_guard lg(mut);
     if (state == writeEntered) {
         state = 0;
@@ -90,6 +184,7 @@ void SharedMutexPrivate::Unlock()
 
 void SharedMutexPrivate::Wait(LinkedList& wList, SharedMutexWaitType wtType)
 {
+    LockWaiterGuard guard(waiterNum);
     auto ctx = ExecuteCtx::Cur();
     auto task = ctx->task;
     if (task == nullptr || task->Block() == BlockType::BLOCK_THREAD) {
@@ -116,6 +211,18 @@ void SharedMutexPrivate::Wait(LinkedList& wList, SharedMutexWaitType wtType)
     mut.lock();
 }
 
+bool SharedMutexPrivate::WaitUntil(LinkedList& wList, SharedMutexWaitType wtType, const TimePoint& tp)
+{
+    LockWaiterGuard guard(waiterNum);
+    bool woken = TimedPark(mut, tp, [&wList, wtType](WaitEntry& we) {
+        we.wtType = wtType;
+        wList.PushBack(we.node);
+        return &we.node;
+    });
+    mut.lock();
+    return woken;
+}
+
 void SharedMutexPrivate::NotifyOne(LinkedList& wList)
 {
     WaitEntry* we = wList.PopFront(&WaitEntry::node);
@@ -158,6 +265,147 @@ void SharedMutexPrivate::NotifyAll(LinkedList& wList)
         we = wList.PopFront(&WaitEntry::node);
     }
 }
+
+std::atomic<int64_t>& SharedMutexPrivate::CurrentSlot()
+{
+    // the counters are only summed up, so a task migrating between lock and unlock is fine
+    static thread_local uint32_t slotIdx = GetThreadSlotIndex();
+    return slots[slotIdx & (slotNum - 1)].cnt;
+}
+
+int64_t SharedMutexPrivate::ReaderNum() const
+{
+    int64_t num = 0;
+    for (uint32_t i = 0; i < slotNum; i++) {
+        num += slots[i].cnt.load(std::memory_order_seq_cst);
+    }
+    return num;
+}
+
+void SharedMutexPrivate::ReadBiasedLock()
+{
+    std::lock_guard lg(mut);
+    while (writer.load(std::memory_order_relaxed) != WRITER_NONE) {
+        Wait(wList1, SharedMutexWaitType::WRITE);
+    }
+    // pairs with the counter update of readers, either the reader sees the writer or the writer sees the reader
+    writer.store(WRITER_PENDING, std::memory_order_seq_cst);
+    while (ReaderNum() != 0) {
+        Wait(wList2, SharedMutexWaitType::NORMAL);
+    }
+    writer.store(WRITER_HELD, std::memory_order_relaxed);
+}
+
+bool SharedMutexPrivate::ReadBiasedTryLock()
+{
+    std::lock_guard lg(mut);
+    if (writer.load(std::memory_order_relaxed) != WRITER_NONE) {
+        return false;
+    }
+    writer.store(WRITER_PENDING, std::memory_order_seq_cst);
+    if (ReaderNum() != 0) {
+        writer.store(WRITER_NONE, std::memory_order_seq_cst);
+        // readers seeing the pending writer may have gone to sleep
+        NotifyAll(wList1);
+        return false;
+    }
+    writer.store(WRITER_HELD, std::memory_order_relaxed);
+    return true;
+}
+
+bool SharedMutexPrivate::ReadBiasedTryLockUntil(const TimePoint& tp)
+{
+    std::lock_guard lg(mut);
+    while (writer.load(std::memory_order_relaxed) != WRITER_NONE) {
+        if (!WaitUntil(wList1, SharedMutexWaitType::WRITE, tp)) {
+            return false;
+        }
+    }
+    writer.store(WRITER_PENDING, std::memory_order_seq_cst);
+    while (ReaderNum() != 0) {
+        if (!WaitUntil(wList2, SharedMutexWaitType::NORMAL, tp)) {
+            writer.store(WRITER_NONE, std::memory_order_seq_cst);
+            // readers seeing the pending writer may have gone to sleep
+            NotifyAll(wList1);
+            return false;
+        }
+    }
+    writer.store(WRITER_HELD, std::memory_order_relaxed);
+    return true;
+}
+
+void SharedMutexPrivate::ReadBiasedLockShared()
+{
+    auto& cnt = CurrentSlot();
+    cnt.fetch_add(1, std::memory_order_seq_cst);
+    if (likely(writer.load(std::memory_order_seq_cst) == WRITER_NONE)) {
+        return;
+    }
+
+    // back off for the writer, then register again once it is gone
+    ReadBiasedUnlockShared(cnt);
+    std::lock_guard lg(mut);
+    while (writer.load(std::memory_order_relaxed) != WRITER_NONE) {
+        Wait(wList1, SharedMutexWaitType::READ);
+    }
+    // writers only announce themselves under mut, so no writer can miss this reader
+    CurrentSlot().fetch_add(1, std::memory_order_seq_cst);
+}
+
+bool SharedMutexPrivate::ReadBiasedTryLockShared()
+{
+    auto& cnt = CurrentSlot();
+    cnt.fetch_add(1, std::memory_order_seq_cst);
+    if (likely(writer.load(std::memory_order_seq_cst) == WRITER_NONE)) {
+        return true;
+    }
+    ReadBiasedUnlockShared(cnt);
+    return false;
+}
+
+bool SharedMutexPrivate::ReadBiasedTryLockSharedUntil(const TimePoint& tp)
+{
+    auto& cnt = CurrentSlot();
+    cnt.fetch_add(1, std::memory_order_seq_cst);
+    if (likely(writer.load(std::memory_order_seq_cst) == WRITER_NONE)) {
+        return true;
+    }
+
+    ReadBiasedUnlockShared(cnt);
+    std::lock_guard lg(mut);
+    while (writer.load(std::memory_order_relaxed) != WRITER_NONE) {
+        if (!WaitUntil(wList1, SharedMutexWaitType::READ, tp)) {
+            return false;
+        }
+    }
+    CurrentSlot().fetch_add(1, std::memory_order_seq_cst);
+    return true;
+}
+
+void SharedMutexPrivate::ReadBiasedUnlock()
+{
+    // no reader can be inside while a writer holds the lock
+    if (writer.load(std::memory_order_relaxed) == WRITER_HELD) {
+        std::lock_guard lg(mut);
+        writer.store(WRITER_NONE, std::memory_order_seq_cst);
+        NotifyAll(wList1);
+        return;
+    }
+    ReadBiasedUnlockShared(CurrentSlot());
+}
+
+void SharedMutexPrivate::ReadBiasedUnlockShared(std::atomic<int64_t>& cnt)
+{
+    cnt.fetch_sub(1, std::memory_order_seq_cst);
+    if (likely(writer.load(std::memory_order_seq_cst) == WRITER_NONE)) {
+        return;
+    }
+    // the pending writer checks the counters and goes to sleep under mut, so it is waiting by now
+    std::lock_guard lg(mut);
+    if (writer.load(std::memory_order_relaxed) == WRITER_PENDING && ReaderNum() == 0) {
+        NotifyOne(wList2);
+    }
+}
 } // namespace ffrt
 
 #ifdef __cplusplus
@@ -171,14 +419,57 @@ int ffrt_rwlock_init(ffrt_rwlock_t* rwlock, const ffrt_rwlockattr_t* attr)
         FFRT_LOGE("rwlock should not be empty");
         return ffrt_error_inval;
     }
-    if (attr != nullptr) {
-        FFRT_LOGE("only support normal rwlock");
+    if (attr != nullptr && attr->storage != RWLOCK_ATTR_NORMAL && attr->storage != RWLOCK_ATTR_READ_BIASED) {
+        FFRT_LOGE("only support normal or read-biased rwlock");
         return ffrt_error_inval;
     }
     static_assert(sizeof(ffrt::SharedMutexPrivate) <= ffrt_rwlock_storage_size,
         "size must be less than ffrt_rwlock_storage_size");
 
-    new (rwlock)ffrt::SharedMutexPrivate();
+    new (rwlock)ffrt::SharedMutexPrivate(attr != nullptr && attr->storage == RWLOCK_ATTR_READ_BIASED);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_rwlockattr_init(ffrt_rwlockattr_t* attr)
+{
+    if (!attr) {
+        FFRT_LOGE("attr should not be empty");
+        return ffrt_error_inval;
+    }
+    attr->storage = RWLOCK_ATTR_NORMAL;
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_rwlockattr_setreadbiased(ffrt_rwlockattr_t* attr, bool read_biased)
+{
+    if (!attr) {
+        FFRT_LOGE("attr should not be empty");
+        return ffrt_error_inval;
+    }
+    attr->storage = read_biased ? RWLOCK_ATTR_READ_BIASED : RWLOCK_ATTR_NORMAL;
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_rwlockattr_getreadbiased(const ffrt_rwlockattr_t* attr, bool* read_biased)
+{
+    if (!attr || !read_biased) {
+        FFRT_LOGE("attr or read_biased should not be empty");
+        return ffrt_error_inval;
+    }
+    *read_biased = (attr->storage == RWLOCK_ATTR_READ_BIASED);
+    return ffrt_success;
+}
+
+API_ATTRIBUTE((visibility("default")))
+int ffrt_rwlockattr_destroy(ffrt_rwlockattr_t* attr)
+{
+    if (!attr) {
+        FFRT_LOGE("attr should not be empty");
+        return ffrt_error_inval;
+    }
     return ffrt_success;
 }
 
@@ -190,6 +481,11 @@ int ffrt_rwlock_wrlock(ffrt_rwlock_t* rwlock)
         return ffrt_error_inval;
     }
     auto p = reinterpret_cast<ffrt::SharedMutexPrivate*>(rwlock);
+    if unlikely(ffrt::LockProfiler::ShouldSample()) {
+        ffrt::LockProfiler::ProfileLock(p, p->WaiterNum(), ffrt::LockProfileType::RWLOCK_WRITE,
+            __builtin_return_address(0), true, [p] { return p->TryLock(); }, [p] { p->Lock(); });
+        return ffrt_success;
+    }
     p->Lock();
     return ffrt_success;
 }
@@ -205,6 +501,17 @@ int ffrt_rwlock_trywrlock(ffrt_rwlock_t* rwlock)
     return p->TryLock() ? ffrt_success : ffrt_error_busy;
 }
 
+API_ATTRIBUTE((visibility("default")))
+int ffrt_rwlock_timedwrlock(ffrt_rwlock_t* rwlock, const struct timespec* time_point)
+{
+    if (!rwlock || !time_point) {
+        FFRT_LOGE("rwlock or time_point should not be empty");
+        return ffrt_error_inval;
+    }
+    auto p = reinterpret_cast<ffrt::SharedMutexPrivate*>(rwlock);
+    return p->TryLockUntil(ffrt::ToTimePoint(*time_point)) ? ffrt_success : ffrt_error_timedout;
+}
+
 API_ATTRIBUTE((visibility("default")))
 int ffrt_rwlock_rdlock(ffrt_rwlock_t* rwlock)
 {
@@ -213,6 +520,11 @@ int ffrt_rwlock_rdlock(ffrt_rwlock_t* rwlock)
         return ffrt_error_inval;
     }
     auto p = reinterpret_cast<ffrt::SharedMutexPrivate*>(rwlock);
+    if unlikely(ffrt::LockProfiler::ShouldSample()) {
+        ffrt::LockProfiler::ProfileLock(p, p->WaiterNum(), ffrt::LockProfileType::RWLOCK_READ,
+            __builtin_return_address(0), false, [p] { return p->TryLockShared(); }, [p] { p->LockShared(); });
+        return ffrt_success;
+    }
     p->LockShared();
     return ffrt_success;
 }
@@ -228,6 +540,17 @@ int ffrt_rwlock_tryrdlock(ffrt_rwlock_t* rwlock)
     return p->TryLockShared() ? ffrt_success : ffrt_error_busy;
 }
 
+API_ATTRIBUTE((visibility("default")))
+int ffrt_rwlock_timedrdlock(ffrt_rwlock_t* rwlock, const struct timespec* time_point)
+{
+    if (!rwlock || !time_point) {
+        FFRT_LOGE("rwlock or time_point should not be empty");
+        return ffrt_error_inval;
+    }
+    auto p = reinterpret_cast<ffrt::SharedMutexPrivate*>(rwlock);
+    return p->TryLockSharedUntil(ffrt::ToTimePoint(*time_point)) ? ffrt_success : ffrt_error_timedout;
+}
+
 API_ATTRIBUTE((visibility("default")))
 int ffrt_rwlock_unlock(ffrt_rwlock_t* rwlock)
 {
@@ -235,6 +558,7 @@ int ffrt_rwlock_unlock(ffrt_rwlock_t* rwlock)
         FFRT_LOGE("rwlock should not be empty");
         return ffrt_error_inval;
     }
+    ffrt::LockProfiler::EndHold(rwlock);
     auto p = reinterpret_cast<ffrt::SharedMutexPrivate*>(rwlock);
     p->Unlock();
     return ffrt_success;
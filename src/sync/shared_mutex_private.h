@@ -16,25 +16,44 @@
 #ifndef _SHARED_MUTEX_PRIVATE_H_
 #define _SHARED_MUTEX_PRIVATE_H_
 
+#include <memory>
 #include "sched/execute_ctx.h"
 #include "sync/sync.h"
+#include "tm/task_base.h"
 
 namespace ffrt {
 class SharedMutexPrivate {
 public:
     void Lock();
     bool TryLock();
+    bool TryLockUntil(const TimePoint& tp);
     void LockShared();
     bool TryLockShared();
+    bool TryLockSharedUntil(const TimePoint& tp);
     void Unlock();
+    // the count of tasks and threads parked on the rwlock, read by the lock profiler
+    const std::atomic<uint32_t>& WaiterNum() const
+    {
+        return waiterNum;
+    }
 
     SharedMutexPrivate() = default;
+    explicit SharedMutexPrivate(bool readBiased);
     ~SharedMutexPrivate() = default;
     SharedMutexPrivate(SharedMutexPrivate const&) = delete;
     void operator = (SharedMutexPrivate const&) = delete;
 
 private:
+    // read-biased mode: readers only touch a per-thread counter slot, writers block new readers and drain the slots
+    struct alignas(cacheline_size) ReaderSlot {
+        std::atomic<int64_t> cnt {0};
+    };
+    static constexpr uint32_t WRITER_NONE = 0;
+    static constexpr uint32_t WRITER_PENDING = 1;
+    static constexpr uint32_t WRITER_HELD = 2;
+
     fast_mutex mut;
+    std::atomic<uint32_t> writer {WRITER_NONE};
 
     LinkedList wList1;
     LinkedList wList2;
@@ -43,9 +62,25 @@ private:
     static constexpr unsigned writeEntered = 1U << (sizeof(unsigned) * __CHAR_BIT__ - 1);
     static constexpr unsigned readersMax = ~writeEntered;
 
+    uint32_t slotNum = 0;
+    std::unique_ptr<ReaderSlot[]> slots;
+    std::atomic<uint32_t> waiterNum {0};
+
     void Wait(LinkedList& wList, SharedMutexWaitType wtType);
+    bool WaitUntil(LinkedList& wList, SharedMutexWaitType wtType, const TimePoint& tp);
     void NotifyOne(LinkedList& wList);
     void NotifyAll(LinkedList& wList);
+
+    void ReadBiasedLock();
+    bool ReadBiasedTryLock();
+    bool ReadBiasedTryLockUntil(const TimePoint& tp);
+    void ReadBiasedLockShared();
+    bool ReadBiasedTryLockShared();
+    bool ReadBiasedTryLockSharedUntil(const TimePoint& tp);
+    void ReadBiasedUnlock();
+    void ReadBiasedUnlockShared(std::atomic<int64_t>& cnt);
+    std::atomic<int64_t>& CurrentSlot();
+    int64_t ReaderNum() const;
 };
 } // namespace ffrt
 #endif
@@ -24,12 +24,19 @@
 #include <functional>
 #include <linux/futex.h>
 #include "sync/delayed_worker.h"
+#include "eu/co_routine.h"
+#include "dfx/trace/ffrt_trace.h"
+#include "tm/cpu_task.h"
 #include "util/ffrt_facade.h"
 #include "sync/sync.h"
 
 #ifdef NS_PER_SEC
 #undef NS_PER_SEC
 #endif
+namespace {
+constexpr uint32_t TIMER_DONE_SPIN_COUNT = 64;
+}
+
 namespace ffrt {
 bool DelayedWakeup(const TimePoint& to, WaitEntry* we, const std::function<void(WaitEntry*)>& wakeup,
     bool skipTimeCheck)
@@ -42,6 +49,153 @@ bool DelayedRemove(const TimePoint& to, WaitEntry* we)
     return FFRTFacade::GetDelayedWorker().remove(to, we);
 }
 
+bool ParkWait(fast_mutex& wlock, ParkEntry& entry, const std::function<bool()>& ready,
+    const std::function<void(ParkEntry&)>& push, void (*trace)(uint64_t gid))
+{
+    auto ctx = ExecuteCtx::Cur();
+    auto task = ctx->task;
+    entry.ctx = ctx;
+    entry.task = task;
+    entry.woken = false;
+    if (task == nullptr || task->Block() == BlockType::BLOCK_THREAD) {
+        entry.threadWait = true;
+        wlock.lock();
+        if (ready()) {
+            wlock.unlock();
+            if (task) {
+                task->Wake();
+            }
+            return false;
+        }
+        push(entry);
+        // the waker sets woken under wn.wl, which is taken before wlock is released so that no wakeup is missed
+        std::unique_lock<std::mutex> lk(ctx->wn.wl);
+        wlock.unlock();
+        ctx->wn.cv.wait(lk, [&entry] { return entry.woken; });
+        if (task) {
+            task->Wake();
+        }
+        return true;
+    }
+
+    trace(task->gid);
+    entry.threadWait = false;
+    bool parked = false;
+    CoWait([&](CoTask*) -> bool {
+        wlock.lock();
+        if (ready()) {
+            wlock.unlock();
+            return false;
+        }
+        push(entry);
+        parked = true;
+        wlock.unlock();
+        // The ownership of the task belongs to the wait list, and the task cannot be accessed any more.
+        return true;
+    });
+    return parked;
+}
+
+void ParkWake(fast_mutex& wlock, ParkEntry* entry)
+{
+    if (entry->threadWait) {
+        std::lock_guard lk(entry->ctx->wn.wl);
+        entry->woken = true;
+        wlock.unlock();
+        entry->ctx->wn.cv.notify_one();
+    } else {
+        CoTask* task = static_cast<CoTask*>(entry->task);
+        entry->woken = true;
+        wlock.unlock();
+        CoWake(task, CoWakeType::NO_TIMEOUT_WAKE);
+    }
+}
+
+bool TimedPark(fast_mutex& wlock, const TimePoint& tp, const std::function<LinkedList*(WaitEntry&)>& push)
+{
+    auto ctx = ExecuteCtx::Cur();
+    auto task = ctx->task;
+    if (task == nullptr || task->Block() == BlockType::BLOCK_THREAD) {
+        WaitUntilEntry& wn = ctx->wn;
+        wn.task = task;
+        LinkedList* node = push(wn);
+        std::unique_lock<std::mutex> lk(wn.wl);
+        wlock.unlock();
+        bool woken = true;
+        for (;;) {
+            bool timeout = wn.cv.wait_until(lk, tp) == std::cv_status::timeout;
+            lk.unlock();
+            wlock.lock();
+            if (!node->InList()) {
+                break;
+            }
+            if (timeout) {
+                LinkedList::Delete(node);
+                woken = false;
+                break;
+            }
+            // spurious wakeup, still on the list
+            lk.lock();
+            wlock.unlock();
+        }
+        wlock.unlock();
+        wn.task = nullptr;
+        if (task) {
+            task->Wake();
+        }
+        return woken;
+    }
+
+    CoTask* coTask = static_cast<CoTask*>(task);
+    LinkedList* node = nullptr;
+    bool timedOut = false;
+    WaitUntilEntry timer(task);
+    timer.hasWaitTime = true;
+    timer.tp = tp;
+    timer.cb = [&wlock, &node, &timedOut, coTask](WaitEntry* we) {
+        wlock.lock();
+        if (!node->InList()) {
+            // popped by a waker, which wakes the task up
+            wlock.unlock();
+            static_cast<WaitUntilEntry*>(we)->status.store(WaitEntryStatus::TIMEOUT_DONE, std::memory_order_release);
+            return;
+        }
+        LinkedList::Delete(node);
+        timedOut = true;
+        wlock.unlock();
+        CoWake(coTask, CoWakeType::TIMEOUT_WAKE);
+    };
+    FFRT_BLOCK_TRACER(task->gid, tmx);
+    CoWait([&](CoTask* task) -> bool {
+        node = push(task->we);
+        if (!DelayedWakeup(timer.tp, &timer, timer.cb)) {
+            LinkedList::Delete(node);
+            timedOut = true;
+            wlock.unlock();
+            return false;
+        }
+        wlock.unlock();
+        // The ownership of the task belongs to the wait list and the DelayedWorker, it cannot be accessed anymore.
+        return true;
+    });
+    if (timedOut) {
+        coTask->coWakeType = CoWakeType::NO_TIMEOUT_WAKE;
+        return false;
+    }
+    if (!DelayedRemove(timer.tp, &timer)) {
+        // the timer has fired and is finding out that the task was woken, wait for it before leaving the frame.
+        // The callback is short, but the DelayedWorker may not be running, so give up the cpu after a few spins.
+        for (uint32_t n = 0; timer.status.load(std::memory_order_acquire) != WaitEntryStatus::TIMEOUT_DONE; ++n) {
+            if (n < TIMER_DONE_SPIN_COUNT) {
+                spin();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+    return true;
+}
+
 void spin_mutex::lock_contended()
 {
     int v = l.load(std::memory_order_relaxed);
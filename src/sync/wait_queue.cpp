@@ -32,17 +32,23 @@ TaskWithNode::TaskWithNode()
 void WaitQueue::ThreadWait(WaitUntilEntry* wn, mutexPrivate* lk, TaskBase* task)
 {
     {
-        std::lock_guard lg(wqlock);
-        wn->task = task;
-        push_back(wn);
-    }
-    {
-        std::unique_lock<std::mutex> nl(wn->wl);
-        lk->unlock();
-        wn->cv.wait(nl);
+        std::unique_lock<std::mutex> nl(wn->wl, std::defer_lock);
+        {
+            std::lock_guard lg(wqlock);
+            wn->task = task;
+            wn->mtx = lk;
+            wn->requeued = false;
+            wn->woken = false;
+            push_back(wn);
+            // a notifier popping wn takes wl, so it cannot requeue wn before the mutex is released here
+            nl.lock();
+            lk->unlock();
+        }
+        wn->cv.wait(nl, [wn] { return wn->woken; });
     }
     wn->task = nullptr;
-    lk->lock();
+    wn->mtx = nullptr;
+    wn->requeued ? lk->lock_requeued() : lk->lock();
     if (task) {
         task->Wake();
     }
@@ -97,6 +103,7 @@ void WaitQueue::SuspendAndWait(mutexPrivate* lk)
     CoTask* coTask = static_cast<CoTask*>(task);
     coTask->wue = new (std::nothrow) WaitUntilEntry(task);
     FFRT_COND_RETURN_VOID(coTask->wue == nullptr, "new WaitUntilEntry failed");
+    coTask->wue->mtx = lk;
     FFRT_BLOCK_TRACER(coTask->gid, cnd);
     CoWait([&](CoTask* task) -> bool {
         std::lock_guard lg(wqlock);
@@ -105,9 +112,10 @@ void WaitQueue::SuspendAndWait(mutexPrivate* lk)
         // The ownership of the task belongs to WaitQueue list, and the task cannot be accessed anymore.
         return true;
     });
+    bool requeued = coTask->wue->requeued;
     delete coTask->wue;
     coTask->wue = nullptr;
-    lk->lock();
+    requeued ? lk->lock_requeued() : lk->lock();
 }
 
 bool WeTimeoutProc(WaitQueue* wq, WaitUntilEntry* wue)
@@ -199,6 +207,31 @@ void WaitQueue::WeNotifyProc(WaitUntilEntry* we)
     delete we;
 }
 
+void WaitQueue::RequeueOrWake(WaitUntilEntry* we, TaskBase* task)
+{
+    // wait morphing: when the mutex is still held, typically by the notifier, the waiter moves to the mutex wait list
+    // and is woken once by unlock, instead of being woken here only to block on the mutex right away.
+    if (task == nullptr || task->GetBlockType() == BlockType::BLOCK_THREAD) {
+        // the waiting thread releases the mutex while holding wl, so the mutex cannot be its own here
+        std::lock_guard<std::mutex> lg(we->wl);
+        we->requeued = true;
+        if (we->mtx->requeue(we)) {
+            return;
+        }
+        we->requeued = false;
+        we->woken = true;
+        we->cv.notify_one();
+        return;
+    }
+    we->requeued = true;
+    if (we->mtx->requeue(we)) {
+        // the entry belongs to the mutex now and may already be woken, it cannot be accessed anymore
+        return;
+    }
+    we->requeued = false;
+    CoWake(static_cast<CoTask*>(task), CoWakeType::NO_TIMEOUT_WAKE);
+}
+
 void WaitQueue::Notify(bool one) noexcept
 {
     // the caller should assure the WaitQueue lifetime.
@@ -218,7 +251,10 @@ void WaitQueue::Notify(bool one) noexcept
         }
         bool isEmpty = empty();
         TaskBase* task = we->task;
-        if (task == nullptr || task->GetBlockType() == BlockType::BLOCK_THREAD) {
+        if (we->mtx != nullptr) {
+            lock.unlock();
+            RequeueOrWake(we, task);
+        } else if (task == nullptr || task->GetBlockType() == BlockType::BLOCK_THREAD) {
             std::lock_guard<std::mutex> lg(we->wl);
             we->status.store(WaitEntryStatus::NOTIFYING, std::memory_order_release);
             lock.unlock();
@@ -42,6 +42,8 @@ public:
     int SuspendAndWaitUntil(mutexPrivate* lk, const TimePoint& tp) noexcept;
     void NotifyAll() noexcept { Notify(false); }
     void NotifyOne() noexcept { Notify(true); }
+    // the count of tasks and threads waiting on the condition variable, read by the lock profiler
+    std::atomic<uint32_t>& WaiterNum() noexcept { return waiterNum; }
 
     WaitQueue()
     {
@@ -63,9 +65,11 @@ public:
 private:
     fast_mutex wqlock;
     WaitUntilEntry* whead;
+    std::atomic<uint32_t> waiterNum {0};
 
 private:
     void WeNotifyProc(WaitUntilEntry* we);
+    void RequeueOrWake(WaitUntilEntry* we, TaskBase* task);
     void ThreadWait(WaitUntilEntry* wn, mutexPrivate* lk, TaskBase* task);
     bool ThreadWaitUntil(WaitUntilEntry* wn, mutexPrivate* lk, const TimePoint& tp, TaskBase* task);
     void Notify(bool one) noexcept;
@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 #include "tm/cpu_task.h"
+#include <sched.h>
 #include <securec.h>
 #include "dfx/trace_record/ffrt_trace_record.h"
 #include "dm/dependence_manager.h"
+#include "core/task_group.h"
 
 #include "internal_inc/osal.h"
 #include "tm/task_factory.h"
@@ -26,6 +28,12 @@
 
 namespace {
 const int TSD_SIZE = 128;
+
+inline uint64_t SteadyNowUs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
 }
 
 namespace ffrt {
@@ -51,6 +59,16 @@ void CPUEUTask::Ready()
     int qos = qos_();
     bool notifyWorker = notifyWorker_;
     this->SetStatus<TaskStatus::READY>();
+    // the first task readied by a task done on a worker of the same QoS runs next on that worker,
+    // unless the worker is not on a cpu the task prefers or the run queue would pick another task first
+    ExecuteCtx* ctx = ExecuteCtx::Cur();
+    if (ctx->collectNextTask && ctx->nextTask == nullptr && ctx->qos == qos_ &&
+        (affinityHint_ == 0 || AffinityHintQueue::Hits(affinityHint_, sched_getcpu())) &&
+        FFRTFacade::GetScheduler().GetScheduler(qos_).CanRunNext(this)) {
+        ctx->nextTask = this;
+        FFRTTraceRecord::TaskEnqueue<ffrt_normal_task>(qos);
+        return;
+    }
     bool isRisingEdge = FFRTFacade::GetScheduler().PushTask(this, false);
     FFRTTraceRecord::TaskEnqueue<ffrt_normal_task>(qos);
     if (notifyWorker) {
@@ -93,10 +111,26 @@ void CPUEUTask::Execute()
         RemoveTaskFromWatchdog(gid);
     }
 #endif
+    // tasks of a cancelled group are dropped like skipped ones
+    auto cancelExp = ffrt::SkipStatus::SUBMITTED;
+    if (unlikely(group_ != nullptr && group_->IsCancelled()) && __atomic_compare_exchange_n(&skipped, &cancelExp,
+        ffrt::SkipStatus::SKIPPED, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        Cancel();
+    }
     if (likely(__atomic_compare_exchange_n(&skipped, &exp, ffrt::SkipStatus::EXECUTED, 0,
         __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))) {
         SetStatus<TaskStatus::EXECUTING>();
+        if (affinityHint_ != 0) {
+            TaskScheduler& sched = FFRTFacade::GetScheduler().GetScheduler(qos_);
+            sched.affinityHintCnt.fetch_add(1, std::memory_order_relaxed);
+            if (AffinityHintQueue::Hits(affinityHint_, sched_getcpu())) {
+                sched.affinityHintHitCnt.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
         f->exec(f);
+        if (deadlineOwner_ && SteadyNowUs() > deadlineUs_) {
+            FFRTFacade::GetScheduler().GetScheduler(qos_).deadlineMissCnt.fetch_add(1, std::memory_order_relaxed);
+        }
     }
     if ((f->reserve[0] & MASK_FOR_HCS_TASK) != MASK_FOR_HCS_TASK) {
         if (f->destroy) {
@@ -104,6 +138,10 @@ void CPUEUTask::Execute()
         }
     }
     FFRT_TASKDONE_MARKER(gid);
+    if (group_ != nullptr) {
+        group_->Leave();
+        group_ = nullptr;
+    }
     // skipped task can not be marked as finish
     if (curStatus == TaskStatus::EXECUTING) {
         SetStatus<TaskStatus::FINISH>();
@@ -140,6 +178,11 @@ CPUEUTask::CPUEUTask(const task_attr_private *attr, CPUEUTask *parent, const uin
 
     if (attr) {
         notifyWorker_ = attr->notifyWorker_;
+        schedPrio_ = static_cast<uint8_t>(attr->taskPrio_);
+        affinityHint_ = attr->affinityHint_;
+        if (attr->deadlineUs_ != 0) {
+            deadlineUs_ = SteadyNowUs() + attr->deadlineUs_;
+        }
 
         if (attr->qos_ == qos_inherit && !IsRoot()) {
             qos_ = parent->qos_;
@@ -164,6 +207,20 @@ CPUEUTask::CPUEUTask(const task_attr_private *attr, CPUEUTask *parent, const uin
 #endif
     }
 
+    group_ = (attr != nullptr && attr->group_ != nullptr) ? attr->group_ :
+        ((parent != nullptr && !parent->IsRoot()) ? parent->group_ : nullptr);
+    if (group_ != nullptr) {
+        group_->Join();
+    }
+
+    if (deadlineUs_ == 0) {
+        deadlineUs_ = (parent != nullptr && !parent->IsRoot()) ? parent->deadlineUs_ :
+            ExecuteCtx::Cur()->intervalDeadlineUs;
+        deadlineOwner_ = (parent == nullptr || parent->IsRoot()) && deadlineUs_ != 0;
+    } else {
+        deadlineOwner_ = true;
+    }
+
     aliveStatus.store(AliveStatus::INITED, std::memory_order_relaxed);
 }
 
@@ -30,6 +30,10 @@ QueueTask::QueueTask(QueueHandler* handler, const task_attr_private* attr, bool
     if (handler) {
         if (attr) {
             label = handler->GetName() + "_" + attr->name_ + "_" + std::to_string(gid);
+            if (handler->GetType() == ffrt_queue_eventhandler_adapter) {
+                nameOffset_ = static_cast<uint32_t>(handler->GetName().size() + 1);
+                nameLen_ = static_cast<uint32_t>(attr->name_.size());
+            }
         } else {
             label = handler->GetName() + "_" + std::to_string(gid);
         }
@@ -63,6 +67,10 @@ QueueTask::~QueueTask()
         cbTask->DecDeleteRef();
         timeoutScheduleCb_ = nullptr;
     }
+    if (historyName_ != nullptr) {
+        historyName_->DecRef();
+        historyName_ = nullptr;
+    }
     FFRT_LOGD("dtor task [gid=%llu]", gid);
 }
 
@@ -89,6 +97,14 @@ void QueueTask::Ready()
     FFRTFacade::GetExecuteUnit().NotifyTask<TaskNotifyType::TASK_ADDED_RTQ>(taskQos, false, isRisingEdge);
 }
 
+void QueueTask::ReadyInline()
+{
+    QoS taskQos = qos_;
+    FFRTTraceRecord::TaskSubmit<ffrt_queue_task>(taskQos);
+    this->SetStatus<TaskStatus::READY>();
+    FFRTTraceRecord::TaskEnqueue<ffrt_queue_task>(taskQos);
+}
+
 void QueueTask::Finish()
 {
     if (createTime != 0) {
@@ -16,7 +16,10 @@
 #define FFRT_QUEUE_TASK_H
 
 #include <atomic>
+#include <new>
 #include <regex>
+#include <string>
+#include <string_view>
 #include "queue/queue_handler.h"
 #include "tm/task_factory.h"
 #ifdef FFRT_ENABLE_HITRACE_CHAIN
@@ -28,6 +31,40 @@
         (reinterpret_cast<size_t>(&((reinterpret_cast<QueueTask*>(0))->func_storage))))))
 
 namespace ffrt {
+// the attr name of a task recorded in a queue history, shared by the task and the history slots that hold it
+class HistoryTaskName {
+public:
+    explicit HistoryTaskName(std::string_view name) : name_(name)
+    {
+    }
+
+    HistoryTaskName(const HistoryTaskName&) = delete;
+    HistoryTaskName& operator=(const HistoryTaskName&) = delete;
+
+    inline void IncRef()
+    {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void DecRef()
+    {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    inline const std::string& Str() const
+    {
+        return name_;
+    }
+
+private:
+    ~HistoryTaskName() = default;
+
+    std::atomic_uint32_t refs_ {1};
+    std::string name_;
+};
+
 class QueueTask : public CoTask {
 public:
     explicit QueueTask(QueueHandler* handler, const task_attr_private* attr = nullptr, bool insertHead = false);
@@ -85,6 +122,26 @@ public:
         return std::regex_match(label, std::regex(pattern));
     }
 
+    inline bool HasName() const
+    {
+        return nameLen_ != NO_NAME;
+    }
+
+    // the attr name as embedded in label, which outlives any use of the view
+    inline std::string_view GetName() const
+    {
+        return std::string_view(label).substr(nameOffset_, nameLen_);
+    }
+
+    // created on the first history record by the worker running the task, nullptr if the task has no name
+    inline HistoryTaskName* GetHistoryName()
+    {
+        if (historyName_ == nullptr && HasName()) {
+            historyName_ = new (std::nothrow) HistoryTaskName(GetName());
+        }
+        return historyName_;
+    }
+
     inline bool InsertHead() const
     {
         return insertHead_;
@@ -95,29 +152,33 @@ public:
         return schedTimeout_;
     }
 
-    inline void SetMonitorTask(WaitUntilEntry* monitorWe)
+    // execution timeout bookkeeping, guarded by the mutex of the handler
+    inline void SetExecStartTime(uint64_t time)
     {
-        monitorWe_ = monitorWe;
+        execStartTime_ = time;
+        isTimeoutReported_ = false;
     }
 
-    inline WaitUntilEntry* GetMonitorTask()
+    inline uint64_t GetExecStartTime() const
     {
-        return monitorWe_;
+        return execStartTime_;
     }
 
-    inline void MonitorTaskStart()
+    inline void SetTimeoutReported()
     {
-        isWeStart_.store(true);
+        isTimeoutReported_ = true;
     }
 
-    inline bool IsMonitorTaskStart()
+    inline bool IsTimeoutReported() const
     {
-        return isWeStart_;
+        return isTimeoutReported_;
     }
     int curTaskIdx = 0;
 
     void Prepare() override;
     void Ready() override;
+    // ready accounting for a task that the pulling worker runs inline instead of pushing it to the scheduler
+    void ReadyInline();
 
     // dequeue means task has been pulled out from it's queue
     inline void Dequeue()
@@ -176,16 +237,20 @@ private:
     uint64_t uptime_;
     QueueHandler* handler_;
     bool insertHead_ = false;
+    static constexpr uint32_t NO_NAME = UINT32_MAX;
+    uint32_t nameOffset_ = 0;
+    uint32_t nameLen_ = NO_NAME; // only set for queues recording task history
+    HistoryTaskName* historyName_ = nullptr;
     uint64_t delay_ = 0;
     uint64_t schedTimeout_ = 0;
 
     QueueTask* nextTask_ = nullptr;
     std::atomic_bool isFinished_ = {false};
     bool onWait_ = {false};
-    std::atomic_bool isWeStart_ = {false};
+    uint64_t execStartTime_ = 0;
+    bool isTimeoutReported_ = false;
 
     ffrt_queue_priority_t prio_ = ffrt_queue_priority_low;
-    WaitUntilEntry* monitorWe_ = nullptr;
     ffrt::mutex finishMutex_;
     ffrt::condition_variable finishCond_;
     ffrt_function_header_t* timeoutScheduleCb_ = nullptr;
@@ -18,6 +18,7 @@
 #include "dfx/log/ffrt_log_api.h"
 #include "dfx/trace_record/ffrt_trace_record.h"
 #include "dfx/trace/ffrt_trace.h"
+#include "sched/task_scheduler.h"
 #include "util/ffrt_facade.h"
 
 namespace ffrt {
@@ -25,41 +26,56 @@ void UVTask::Ready()
 {
     QoS taskQos = qos_;
     FFRTTraceRecord::TaskSubmit<ffrt_uv_task>(taskQos);
-    if (FFRTFacade::GetScheduler().GetScheduler(taskQos).PushUVTaskToWaitingQueue(this)) {
-        FFRTTraceRecord::TaskEnqueue<ffrt_uv_task>(taskQos);
-        return;
+    UVTask* task = FFRTFacade::GetScheduler().GetScheduler(taskQos).AcquireUVPermit(this);
+    FFRTTraceRecord::TaskEnqueue<ffrt_uv_task>(taskQos);
+    if (task != nullptr) {
+        PushReady(task);
     }
+}
 
-    SetStatus<TaskStatus::READY>();
-    bool isRisingEdge = FFRTFacade::GetScheduler().PushTask(this, false);
-
-    FFRTTraceRecord::TaskEnqueue<ffrt_uv_task>(taskQos);
+void UVTask::PushReady(UVTask* task)
+{
+    QoS taskQos = task->qos_;
+    task->SetStatus<TaskStatus::READY>();
+    bool isRisingEdge = FFRTFacade::GetScheduler().PushTask(task, false);
     FFRTFacade::GetExecuteUnit().NotifyTask<TaskNotifyType::TASK_ADDED_RTQ>(taskQos, false, isRisingEdge);
 }
 
+void UVTask::FreeMem()
+{
+    TaskScheduler::WaitUVCancelDone(uvWork);
+    TaskFactory<UVTask>::Free(this);
+}
+
 void UVTask::Execute()
 {
     if (uvWork == nullptr) {
         FFRT_SYSEVENT_LOGE("task is nullptr");
-        DecDeleteRef();
-        return;
-    }
-
-    // if the concurrency reaches the upper limit, this worker cannot execute UV tasks.
-    if (!FFRTFacade::GetScheduler().GetScheduler(qos_).CheckUVTaskConcurrency(this)) {
+        DropImpl(this);
         return;
     }
 
     ffrt_executor_task_func func = FuncManager::Instance()->getFunc(ffrt_uv_task);
     if (func == nullptr) {
         FFRT_SYSEVENT_LOGE("Static func is nullptr");
-        DecDeleteRef();
+        DropImpl(this);
         return;
     }
 
     ExecuteImpl(this, func);
 }
 
+void UVTask::DropImpl(UVTask* task)
+{
+    TaskScheduler& sched = FFRTFacade::GetScheduler().GetScheduler(task->qos_);
+    task->DecDeleteRef();
+    // the permit of the dropped task goes to the next waiting one
+    UVTask* next = sched.ReleaseUVPermit();
+    if (next != nullptr) {
+        PushReady(next);
+    }
+}
+
 void UVTask::ExecuteImpl(UVTask* task, ffrt_executor_task_func func)
 {
     ExecuteCtx* ctx = ExecuteCtx::Cur();
@@ -75,7 +91,7 @@ void UVTask::ExecuteImpl(UVTask* task, ffrt_executor_task_func func)
         FFRT_TASKDONE_MARKER(task->gid); // task finish marker for uv task
         FFRTTraceRecord::TaskDone<ffrt_uv_task>(taskQos);
         task->DecDeleteRef();
-        task = FFRTFacade::GetScheduler().GetScheduler(taskQos).PickWaitingUVTask();
+        task = FFRTFacade::GetScheduler().GetScheduler(taskQos).ReleaseUVPermit();
     }
 }
 } // namespace ffrt
@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 #include <chrono>
+#include <thread>
+#include <vector>
 #include "c/thread.h"
 #include "ffrt_inner.h"
 #include "../common.h"
@@ -95,6 +97,128 @@ HWTEST_F(CVTest, conditonV_nullptr_test, TestSize.Level0)
     EXPECT_EQ(ffrt_cond_timedwait(&cond, nullptr, nullptr), ffrt_error_inval);
 }
 
+/**
+ * @tc.name: conditonV_notify_all_under_mutex
+ * @tc.desc: Test function of notify_all called under the mutex, the waiters proceed after the mutex is released
+ * @tc.type: FUNC
+ */
+HWTEST_F(CVTest, conditonV_notify_all_under_mutex, TestSize.Level0)
+{
+    constexpr int taskNum = 8;
+    constexpr int threadNum = 2;
+    ffrt::condition_variable cond;
+    ffrt::mutex lock_;
+    bool ready = false;
+    int woken = 0;
+    std::atomic<int> waiting {0};
+
+    auto waiter = [&]() {
+        std::unique_lock lck(lock_);
+        waiting++;
+        cond.wait(lck, [&] { return ready; });
+        woken++;
+    };
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit(waiter, {}, {});
+    }
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadNum; i++) {
+        threads.emplace_back(waiter);
+    }
+    while (waiting.load() != taskNum + threadNum) {
+        usleep(1000);
+    }
+
+    {
+        // waiters are requeued to lock_ and proceed only after it is released
+        std::unique_lock lck(lock_);
+        ready = true;
+        cond.notify_all();
+        usleep(10000);
+        EXPECT_EQ(woken, 0);
+    }
+    ffrt::wait();
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(woken, taskNum + threadNum);
+}
+
+/**
+ * @tc.name: conditonV_notify_one_ping_pong
+ * @tc.desc: Test function of notify_one between a task and a thread, called with and without the mutex
+ * @tc.type: FUNC
+ */
+HWTEST_F(CVTest, conditonV_notify_one_ping_pong, TestSize.Level0)
+{
+    constexpr int loopNum = 1000;
+    ffrt::condition_variable cond;
+    ffrt::mutex lock_;
+    int turn = 0;
+
+    auto player = [&](int self) {
+        for (int i = 0; i < loopNum; i++) {
+            std::unique_lock lck(lock_);
+            cond.wait(lck, [&] { return turn % 2 == self; });
+            turn++;
+            // player 0 notifies under the mutex, player 1 after releasing it
+            if (self == 0) {
+                cond.notify_one();
+            } else {
+                lck.unlock();
+                cond.notify_one();
+            }
+        }
+    };
+    ffrt::submit([&]() { player(0); }, {}, {});
+    std::thread t([&]() { player(1); });
+    ffrt::wait();
+    t.join();
+    EXPECT_EQ(turn, loopNum * 2);
+}
+
+/**
+ * @tc.name: conditonV_thread_notify_without_mutex
+ * @tc.desc: Test function of notify_one from a thread not holding the mutex while a thread waits on it and
+ *           another thread keeps taking the mutex, so the waiter is requeued while it may still release the mutex
+ * @tc.type: FUNC
+ */
+HWTEST_F(CVTest, conditonV_thread_notify_without_mutex, TestSize.Level0)
+{
+    constexpr int loopNum = 1000;
+    ffrt::condition_variable cond;
+    ffrt::mutex lock_;
+    std::atomic<int> round {0};
+    std::atomic<int> done {0};
+    std::atomic<bool> stop {false};
+
+    std::thread waiter([&]() {
+        for (int i = 0; i < loopNum; i++) {
+            std::unique_lock lck(lock_);
+            cond.wait(lck, [&] { return round.load() > i; });
+            done++;
+        }
+    });
+    std::thread holder([&]() {
+        while (!stop.load()) {
+            lock_.lock();
+            lock_.unlock();
+        }
+    });
+    for (int i = 0; i < loopNum; i++) {
+        round++;
+        // the waiter may not be waiting yet, notify until it has seen the round
+        while (done.load() <= i) {
+            cond.notify_one();
+            std::this_thread::yield();
+        }
+    }
+    waiter.join();
+    stop = true;
+    holder.join();
+    EXPECT_EQ(done.load(), loopNum);
+}
+
 class MutexTest : public testing::Test {
 protected:
     static void SetUpTestCase()
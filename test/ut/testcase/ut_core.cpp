@@ -901,4 +901,209 @@ HWTEST_F(CoreTest, FfrtNotifyWorkers_AbnormalInput_None, TestSize.Level1)
     ffrt_notify_workers(qosMin - 1, 1);
     ffrt_notify_workers(qosMax + 1, 1);
     ffrt_notify_workers(qosMin, 0);
-}
\ No newline at end of file
+}
+
+/*
+ * 测试用例名称：parallel_for_covers_range
+ * 测试用例描述：测试ffrt::parallel_for在线程和任务中调用时每个下标恰好执行一次
+ * 预置条件    ：无
+ * 操作步骤    ：在线程和任务中分别调用parallel_for，包括空区间和嵌套调用
+ * 预期结果    ：每个下标执行一次，空区间不执行
+*/
+HWTEST_F(CoreTest, parallel_for_covers_range, TestSize.Level0)
+{
+    constexpr int n = 10000;
+    std::vector<std::atomic<int>> hits(n);
+    ffrt::parallel_for(0, n, [&](int i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+    ffrt::submit([&]() {
+        ffrt::parallel_for(0, n, [&](int i) { hits[i].fetch_add(1, std::memory_order_relaxed); }, 16);
+    });
+    ffrt::wait();
+    for (int i = 0; i < n; i++) {
+        EXPECT_EQ(hits[i].load(), 2);
+    }
+
+    bool called = false;
+    ffrt::parallel_for(5, 5, [&](int) { called = true; });
+    EXPECT_FALSE(called);
+
+    std::atomic<int> count {0};
+    ffrt::parallel_for(0, 64, [&](int) {
+        ffrt::parallel_for(0, 64, [&](int) { count.fetch_add(1, std::memory_order_relaxed); });
+    });
+    EXPECT_EQ(count.load(), 64 * 64);
+}
+
+/*
+ * 测试用例名称：parallel_reduce_keeps_order
+ * 测试用例描述：测试ffrt::parallel_reduce按下标顺序合并各部分结果
+ * 预置条件    ：无
+ * 操作步骤    ：用parallel_reduce求和，并用不满足交换律的拼接运算归约
+ * 预期结果    ：结果与串行计算一致
+*/
+HWTEST_F(CoreTest, parallel_reduce_keeps_order, TestSize.Level0)
+{
+    constexpr uint64_t n = 100000;
+    uint64_t sum = ffrt::parallel_reduce(uint64_t(0), n, uint64_t(0),
+        [](uint64_t b, uint64_t e, uint64_t acc) {
+            for (uint64_t i = b; i < e; i++) {
+                acc += i;
+            }
+            return acc;
+        },
+        [](uint64_t l, uint64_t r) { return l + r; }, 64);
+    EXPECT_EQ(sum, n * (n - 1) / 2);
+
+    auto concat = [](std::vector<int> l, std::vector<int> r) {
+        l.insert(l.end(), r.begin(), r.end());
+        return l;
+    };
+    std::vector<int> seq = ffrt::parallel_reduce(0, 2000, std::vector<int> {},
+        [](int b, int e, std::vector<int> acc) {
+            for (int i = b; i < e; i++) {
+                acc.push_back(i);
+            }
+            return acc;
+        }, concat, 8);
+    ASSERT_EQ(seq.size(), 2000);
+    for (int i = 0; i < 2000; i++) {
+        EXPECT_EQ(seq[i], i);
+    }
+    EXPECT_EQ(ffrt::parallel_reduce(3, 3, 7, [](int, int, int acc) { return acc; },
+        [](int l, int r) { return l + r; }), 7);
+}
+
+/*
+ * 测试用例名称：task_graph_replays_dependencies
+ * 测试用例描述：测试ffrt::task_graph记录的依赖在每次launch时都被遵守
+ * 预置条件    ：无
+ * 操作步骤    ：记录写后读、读后写、写后写依赖的任务图，实例化后多次launch
+ * 预期结果    ：每次launch中任务按依赖顺序执行，连续launch依次执行
+ */
+HWTEST_F(CoreTest, task_graph_replays_dependencies, TestSize.Level0)
+{
+    int a = 0;
+    int b = 0;
+    std::vector<int> order;
+    ffrt::mutex mtx;
+    auto record = [&](int id) {
+        std::lock_guard<ffrt::mutex> lk(mtx);
+        order.push_back(id);
+    };
+
+    ffrt::task_graph g;
+    g.submit([&] { record(0); a = 1; }, {}, {&a});
+    g.submit([&] { record(1); b = a + 1; }, {&a}, {&b});
+    g.submit([&] { record(2); EXPECT_EQ(a, 1); }, {&a}, {});
+    g.submit([&] { record(3); a = b * 10; }, {&b}, {&a});
+    g.submit([&] { record(4); b = a; }, {&a}, {&b});
+    EXPECT_EQ(g.size(), 5);
+
+    ffrt::graph_exec exec = g.instantiate();
+    constexpr int launches = 20;
+    for (int i = 0; i < launches; i++) {
+        exec.launch();
+    }
+    exec.wait();
+    EXPECT_EQ(a, 20);
+    EXPECT_EQ(b, 20);
+    ASSERT_EQ(order.size(), 5 * launches);
+    for (int i = 0; i < launches; i++) {
+        auto it = order.begin() + i * 5;
+        EXPECT_EQ(it[0], 0);
+        EXPECT_EQ(it[1] + it[2], 3);
+        EXPECT_EQ(it[3], 3);
+        EXPECT_EQ(it[4], 4);
+    }
+
+    ffrt::graph_exec empty = ffrt::task_graph().instantiate();
+    empty.launch();
+    empty.wait();
+}
+
+/*
+ * 测试用例名称：task_group_wait_joins_descendants
+ * 测试用例描述：测试ffrt::task_group的wait等待组内任务及其子孙任务完成
+ * 预置条件    ：无
+ * 操作步骤    ：向task_group提交任务，任务内再用ffrt::submit提交子任务，调用wait
+ * 预期结果    ：wait返回时所有子孙任务均已执行
+ */
+HWTEST_F(CoreTest, task_group_wait_joins_descendants, TestSize.Level0)
+{
+    std::atomic<int> count {0};
+    ffrt::task_group group;
+    for (int i = 0; i < 10; i++) {
+        group.submit([&] {
+            for (int j = 0; j < 10; j++) {
+                ffrt::submit([&] {
+                    usleep(100);
+                    ffrt::submit([&] { count.fetch_add(1); });
+                });
+            }
+            EXPECT_EQ(ffrt::task_group().wait(), ffrt_success);
+        });
+    }
+    EXPECT_EQ(group.wait(), ffrt_success);
+    EXPECT_EQ(count.load(), 100);
+    EXPECT_FALSE(group.is_cancelled());
+    EXPECT_FALSE(ffrt::this_task::is_cancelled());
+}
+
+/*
+ * 测试用例名称：task_group_cancel_drops_queued
+ * 测试用例描述：测试取消ffrt::task_group后未开始的组内任务不再执行，正在执行的任务能感知取消
+ * 预置条件    ：无
+ * 操作步骤    ：提交一个轮询取消状态的任务和依赖它的后继任务，取消task_group后等待
+ * 预期结果    ：轮询任务感知到取消，后继任务及其子任务均未执行
+ */
+HWTEST_F(CoreTest, task_group_cancel_drops_queued, TestSize.Level0)
+{
+    int x = 0;
+    std::atomic<bool> started {false};
+    std::atomic<bool> sawCancel {false};
+    std::atomic<int> ran {0};
+    ffrt::task_group group;
+    group.submit([&] {
+        started = true;
+        while (!ffrt::this_task::is_cancelled()) {
+            usleep(100);
+        }
+        sawCancel = true;
+        ffrt::submit([&] { ran.fetch_add(1); });
+    }, {}, {&x});
+    for (int i = 0; i < 20; i++) {
+        group.submit([&] { ran.fetch_add(1); }, {&x}, {});
+    }
+    while (!started) {
+        usleep(100);
+    }
+    group.cancel();
+    group.submit([&] { ran.fetch_add(1); });
+    EXPECT_EQ(group.wait(), ffrt_success);
+    EXPECT_TRUE(group.is_cancelled());
+    EXPECT_TRUE(sawCancel.load());
+    EXPECT_EQ(ran.load(), 0);
+}
+
+/*
+ * 测试用例名称：task_group_cancel_keeps_skipped
+ * 测试用例描述：测试已被ffrt::skip的组内任务在task_group取消后仍不执行
+ * 预置条件    ：无
+ * 操作步骤    ：组内任务提交延时子任务并skip，再取消task_group并等待
+ * 预期结果    ：skip成功，子任务未执行
+ */
+HWTEST_F(CoreTest, task_group_cancel_keeps_skipped, TestSize.Level0)
+{
+    int skipRet = -1;
+    std::atomic<int> ran {0};
+    ffrt::task_group group;
+    group.submit([&] {
+        ffrt::task_handle h = ffrt::submit_h([&] { ran.fetch_add(1); }, {}, {}, ffrt::task_attr().delay(10000));
+        skipRet = ffrt::skip(h);
+        group.cancel();
+    });
+    EXPECT_EQ(group.wait(), ffrt_success);
+    ffrt::wait();
+    EXPECT_EQ(skipRet, ffrt_success);
+    EXPECT_EQ(ran.load(), 0);
+}
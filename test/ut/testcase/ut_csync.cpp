@@ -173,6 +173,307 @@ HWTEST_F(SyncTest, shared_mutex_try_lock, TestSize.Level0)
     lock.unlock();
 }
 
+/**
+ * @tc.name: fair_mutex_handoff
+ * @tc.desc: Test function of fair mutex:a starving waiter gets the lock directly on unlock
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, fair_mutex_handoff, TestSize.Level0)
+{
+    ffrt_mutexattr_t attr;
+    bool fair = false;
+    int type = -1;
+    EXPECT_EQ(ffrt_mutexattr_init(&attr), ffrt_success);
+    EXPECT_EQ(ffrt_mutexattr_setfair(&attr, true), ffrt_success);
+    EXPECT_EQ(ffrt_mutexattr_settype(&attr, ffrt_mutex_normal), ffrt_success);
+    EXPECT_EQ(ffrt_mutexattr_getfair(&attr, &fair), ffrt_success);
+    EXPECT_TRUE(fair);
+    EXPECT_EQ(ffrt_mutexattr_gettype(&attr, &type), ffrt_success);
+    EXPECT_EQ(type, ffrt_mutex_normal);
+    EXPECT_EQ(ffrt_mutexattr_setfair(nullptr, true), ffrt_error_inval);
+    EXPECT_EQ(ffrt_mutexattr_getfair(&attr, nullptr), ffrt_error_inval);
+
+    ffrt_mutex_t mtx;
+    EXPECT_EQ(ffrt_mutex_init(&mtx, &attr), ffrt_success);
+    std::atomic<bool> owned = false;
+    ffrt_mutex_lock(&mtx);
+    ffrt::submit([&]() {
+        ffrt_mutex_lock(&mtx);
+        owned = true;
+        ffrt::this_task::sleep_for(10ms);
+        owned = false;
+        ffrt_mutex_unlock(&mtx);
+    });
+    // let the waiter starve before unlocking
+    usleep(5000);
+    ffrt_mutex_unlock(&mtx);
+    EXPECT_NE(ffrt_mutex_trylock(&mtx), ffrt_success);
+    ffrt::wait();
+    EXPECT_FALSE(owned);
+    EXPECT_EQ(ffrt_mutex_trylock(&mtx), ffrt_success);
+    ffrt_mutex_unlock(&mtx);
+
+    ffrt_mutex_destroy(&mtx);
+    ffrt_mutexattr_destroy(&attr);
+}
+
+/**
+ * @tc.name: fair_mutex_recursive_inval
+ * @tc.desc: Test function of fair mutex:a fair recursive mutex is rejected instead of silently losing fairness
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, fair_mutex_recursive_inval, TestSize.Level0)
+{
+    ffrt_mutexattr_t attr;
+    bool fair = false;
+    EXPECT_EQ(ffrt_mutexattr_init(&attr), ffrt_success);
+    EXPECT_EQ(ffrt_mutexattr_setfair(&attr, true), ffrt_success);
+    EXPECT_EQ(ffrt_mutexattr_settype(&attr, ffrt_mutex_recursive), ffrt_success);
+    EXPECT_EQ(ffrt_mutexattr_getfair(&attr, &fair), ffrt_success);
+    EXPECT_TRUE(fair);
+    ffrt_mutex_t mtx;
+    EXPECT_EQ(ffrt_mutex_init(&mtx, &attr), ffrt_error_inval);
+
+    // the recursive type alone still works once the fair mode is cleared
+    EXPECT_EQ(ffrt_mutexattr_setfair(&attr, false), ffrt_success);
+    EXPECT_EQ(ffrt_mutex_init(&mtx, &attr), ffrt_success);
+    EXPECT_EQ(ffrt_mutex_lock(&mtx), ffrt_success);
+    EXPECT_EQ(ffrt_mutex_lock(&mtx), ffrt_success);
+    EXPECT_EQ(ffrt_mutex_unlock(&mtx), ffrt_success);
+    EXPECT_EQ(ffrt_mutex_unlock(&mtx), ffrt_success);
+    ffrt_mutex_destroy(&mtx);
+    ffrt_mutexattr_destroy(&attr);
+}
+
+/**
+ * @tc.name: fair_mutex_cpp
+ * @tc.desc: Test function of fair mutex:ffrt::fair_mutex hands over ownership
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, fair_mutex_cpp, TestSize.Level0)
+{
+    ffrt::fair_mutex mtx;
+    std::atomic<bool> owned = false;
+    mtx.lock();
+    EXPECT_FALSE(mtx.try_lock());
+    ffrt::submit([&]() {
+        mtx.lock();
+        owned = true;
+        ffrt::this_task::sleep_for(10ms);
+        owned = false;
+        mtx.unlock();
+    });
+    // let the waiter starve before unlocking
+    usleep(5000);
+    mtx.unlock();
+    EXPECT_FALSE(mtx.try_lock());
+    ffrt::wait();
+    EXPECT_FALSE(owned);
+    EXPECT_TRUE(mtx.try_lock());
+    mtx.unlock();
+
+    EXPECT_TRUE(mtx.try_lock_for(1ms));
+    EXPECT_FALSE(mtx.try_lock_for(1ms));
+    mtx.unlock();
+}
+
+/**
+ * @tc.name: fair_mutex_stress
+ * @tc.desc: Test function of fair mutex under contention
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, fair_mutex_stress, TestSize.Level0)
+{
+    constexpr int taskNum = 10;
+    constexpr int loopNum = 1000;
+    ffrt_mutexattr_t attr;
+    ffrt_mutexattr_init(&attr);
+    ffrt_mutexattr_setfair(&attr, true);
+    ffrt_mutex_t mtx;
+    EXPECT_EQ(ffrt_mutex_init(&mtx, &attr), ffrt_success);
+
+    int x = 0;
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&]() {
+            for (int j = 0; j < loopNum; j++) {
+                ffrt_mutex_lock(&mtx);
+                x++;
+                ffrt_mutex_unlock(&mtx);
+            }
+        });
+    }
+    std::thread t([&]() {
+        for (int j = 0; j < loopNum; j++) {
+            ffrt_mutex_lock(&mtx);
+            x++;
+            ffrt_mutex_unlock(&mtx);
+        }
+    });
+    ffrt::wait();
+    t.join();
+    EXPECT_EQ(x, (taskNum + 1) * loopNum);
+
+    ffrt_mutex_destroy(&mtx);
+    ffrt_mutexattr_destroy(&attr);
+}
+
+/**
+ * @tc.name: mutex_try_lock_for
+ * @tc.desc: Test function of mutex:try_lock_for times out in tasks and threads, and succeeds once unlocked
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, mutex_try_lock_for, TestSize.Level0)
+{
+    ffrt::mutex mtx;
+    mtx.lock();
+    std::atomic<bool> taskLocked {true};
+    ffrt::submit([&]() {
+        auto begin = std::chrono::steady_clock::now();
+        taskLocked = mtx.try_lock_for(std::chrono::milliseconds(10));
+        EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(10));
+    });
+    ffrt::wait();
+    EXPECT_FALSE(taskLocked.load());
+    std::thread t([&]() {
+        EXPECT_FALSE(mtx.try_lock_until(std::chrono::steady_clock::now() + std::chrono::milliseconds(5)));
+    });
+    t.join();
+
+    ffrt::submit([&]() {
+        taskLocked = mtx.try_lock_for(std::chrono::seconds(10));
+        if (taskLocked) {
+            mtx.unlock();
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    mtx.unlock();
+    ffrt::wait();
+    EXPECT_TRUE(taskLocked.load());
+
+    ffrt_mutexattr_t attr;
+    ffrt_mutexattr_init(&attr);
+    ffrt_mutexattr_setfair(&attr, true);
+    ffrt_mutex_t fairMtx;
+    ffrt_mutex_init(&fairMtx, &attr);
+    ffrt_mutex_lock(&fairMtx);
+    timespec ts = ffrt::detail::to_deadline(std::chrono::milliseconds(5));
+    EXPECT_EQ(ffrt_mutex_timedlock(&fairMtx, &ts), ffrt_error_timedout);
+    ffrt_mutex_unlock(&fairMtx);
+    ts = ffrt::detail::to_deadline(std::chrono::milliseconds(5));
+    EXPECT_EQ(ffrt_mutex_timedlock(&fairMtx, &ts), ffrt_success);
+    ffrt_mutex_unlock(&fairMtx);
+    ffrt_mutex_destroy(&fairMtx);
+    ffrt_mutexattr_destroy(&attr);
+
+    ffrt::recursive_mutex rmtx;
+    rmtx.lock();
+    EXPECT_TRUE(rmtx.try_lock_for(std::chrono::milliseconds(1)));
+    rmtx.unlock();
+    rmtx.unlock();
+    EXPECT_EQ(ffrt_mutex_timedlock(nullptr, &ts), ffrt_error_inval);
+    EXPECT_EQ(ffrt_mutex_timedlock(&mtx, nullptr), ffrt_error_inval);
+}
+
+/**
+ * @tc.name: mutex_try_lock_for_stress
+ * @tc.desc: Test function of mutex:timed waiters giving up do not swallow wakeups of other waiters
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, mutex_try_lock_for_stress, TestSize.Level0)
+{
+    constexpr int taskNum = 8;
+    constexpr int loopNum = 200;
+    ffrt::mutex mtx;
+    int x = 0;
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&, i]() {
+            for (int j = 0; j < loopNum; j++) {
+                if (i % 2 == 0 || !mtx.try_lock_for(std::chrono::microseconds(50))) {
+                    mtx.lock();
+                }
+                x++;
+                mtx.unlock();
+            }
+        });
+    }
+    std::thread t([&]() {
+        for (int j = 0; j < loopNum; j++) {
+            if (!mtx.try_lock_for(std::chrono::microseconds(50))) {
+                mtx.lock();
+            }
+            x++;
+            mtx.unlock();
+        }
+    });
+    ffrt::wait();
+    t.join();
+    EXPECT_EQ(x, (taskNum + 1) * loopNum);
+}
+
+/**
+ * @tc.name: shared_mutex_try_lock_for
+ * @tc.desc: Test function of shared_mutex:timed exclusive and shared locks in normal and read-biased modes
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, shared_mutex_try_lock_for, TestSize.Level0)
+{
+    ffrt::shared_mutex smtx;
+    smtx.lock_shared();
+    std::atomic<bool> writeLocked {true};
+    std::atomic<bool> readLocked {false};
+    ffrt::submit([&]() {
+        writeLocked = smtx.try_lock_for(std::chrono::milliseconds(5));
+        readLocked = smtx.try_lock_shared_for(std::chrono::milliseconds(5));
+        if (readLocked) {
+            smtx.unlock_shared();
+        }
+    });
+    ffrt::wait();
+    EXPECT_FALSE(writeLocked.load());
+    EXPECT_TRUE(readLocked.load());
+    smtx.unlock_shared();
+
+    // the writer giving up must let the readers queued behind it in
+    smtx.lock_shared();
+    ffrt::submit([&]() {
+        writeLocked = smtx.try_lock_for(std::chrono::milliseconds(20));
+    });
+    ffrt::submit([&]() {
+        ffrt::this_task::sleep_for(std::chrono::milliseconds(5));
+        readLocked = smtx.try_lock_shared_for(std::chrono::seconds(10));
+        if (readLocked) {
+            smtx.unlock_shared();
+        }
+    });
+    ffrt::wait();
+    EXPECT_FALSE(writeLocked.load());
+    EXPECT_TRUE(readLocked.load());
+    smtx.unlock_shared();
+
+    ffrt_rwlockattr_t attr;
+    ffrt_rwlockattr_init(&attr);
+    ffrt_rwlockattr_setreadbiased(&attr, true);
+    ffrt_rwlock_t rwlock;
+    ffrt_rwlock_init(&rwlock, &attr);
+    ffrt_rwlock_wrlock(&rwlock);
+    timespec ts = ffrt::detail::to_deadline(std::chrono::milliseconds(5));
+    EXPECT_EQ(ffrt_rwlock_timedrdlock(&rwlock, &ts), ffrt_error_timedout);
+    ffrt_rwlock_unlock(&rwlock);
+    ffrt_rwlock_rdlock(&rwlock);
+    ts = ffrt::detail::to_deadline(std::chrono::milliseconds(5));
+    EXPECT_EQ(ffrt_rwlock_timedwrlock(&rwlock, &ts), ffrt_error_timedout);
+    ts = ffrt::detail::to_deadline(std::chrono::milliseconds(5));
+    EXPECT_EQ(ffrt_rwlock_timedrdlock(&rwlock, &ts), ffrt_success);
+    ffrt_rwlock_unlock(&rwlock);
+    ffrt_rwlock_unlock(&rwlock);
+    ts = ffrt::detail::to_deadline(std::chrono::milliseconds(5));
+    EXPECT_EQ(ffrt_rwlock_timedwrlock(&rwlock, &ts), ffrt_success);
+    ffrt_rwlock_unlock(&rwlock);
+    ffrt_rwlock_destroy(&rwlock);
+    EXPECT_EQ(ffrt_rwlock_timedwrlock(nullptr, &ts), ffrt_error_inval);
+    EXPECT_EQ(ffrt_rwlock_timedrdlock(&rwlock, nullptr), ffrt_error_inval);
+}
+
 /**
  * @tc.name: mutex_lock_with_BlockThread
  * @tc.desc: Test function of mutex:lock in Thread mode
@@ -331,6 +632,53 @@ HWTEST_F(SyncTest, lock_stress, TestSize.Level0)
     EXPECT_EQ(acc, (M * N + J));
 }
 
+/**
+ * @tc.name: mutex_contended_spin_then_park
+ * @tc.desc: Test ffrt::mutex keeps mutual exclusion while contenders spin, park and get woken in turn
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncTest, mutex_contended_spin_then_park, TestSize.Level1)
+{
+    const int taskNum = 8;
+    const int threadNum = 2;
+    const int rounds = 2000;
+    ffrt::mutex mtx;
+    std::atomic<int> inside = 0;
+    std::atomic<int> overlap = 0;
+    int acc = 0;
+    auto contend = [&]() {
+        for (int j = 0; j < rounds; ++j) {
+            std::lock_guard lock(mtx);
+            if (inside.fetch_add(1) != 0) {
+                overlap++;
+            }
+            acc++;
+            // short sections are ridden out by spinning, the occasional long one makes the contenders park
+            if (j % 100 == 0) {
+                usleep(100);
+            }
+            inside.fetch_sub(1);
+        }
+    };
+
+    for (int i = 0; i < taskNum; ++i) {
+        ffrt::submit(contend, {}, {});
+    }
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadNum; ++i) {
+        threads.emplace_back(contend);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    ffrt::wait();
+
+    EXPECT_EQ(overlap, 0);
+    EXPECT_EQ(acc, (taskNum + threadNum) * rounds);
+    EXPECT_TRUE(mtx.try_lock());
+    mtx.unlock();
+}
+
 HWTEST_F(SyncTest, lock_stress_c_api, TestSize.Level0)
 {
     // trigger lazy init
@@ -560,6 +908,93 @@ HWTEST_F(SyncTest, sharedMutexTestInit, TestSize.Level0)
     EXPECT_EQ(x, ffrt_error_inval);
 }
 
+/*
+ * 测试用例名称：sharedMutexReadBiased
+ * 测试用例描述：读偏向shared_mutex的读写互斥
+ * 预置条件    ：通过属性创建读偏向的rwlock
+ * 操作步骤    ：1.并发提交读任务和写任务
+                2.读任务检查读到的两个数据一致，写任务同时修改两个数据
+ * 预期结果    ：读任务不会读到写了一半的数据，写任务全部完成
+ */
+HWTEST_F(SyncTest, sharedMutexReadBiased, TestSize.Level0)
+{
+    ffrt_rwlockattr_t attr;
+    bool readBiased = false;
+    EXPECT_EQ(ffrt_rwlockattr_init(&attr), ffrt_success);
+    EXPECT_EQ(ffrt_rwlockattr_setreadbiased(&attr, true), ffrt_success);
+    EXPECT_EQ(ffrt_rwlockattr_getreadbiased(&attr, &readBiased), ffrt_success);
+    EXPECT_TRUE(readBiased);
+    EXPECT_EQ(ffrt_rwlockattr_setreadbiased(nullptr, true), ffrt_error_inval);
+
+    ffrt_rwlock_t rwlock;
+    EXPECT_EQ(ffrt_rwlock_init(&rwlock, &attr), ffrt_success);
+    EXPECT_EQ(ffrt_rwlock_tryrdlock(&rwlock), ffrt_success);
+    EXPECT_EQ(ffrt_rwlock_trywrlock(&rwlock), ffrt_error_busy);
+    ffrt_rwlock_unlock(&rwlock);
+    EXPECT_EQ(ffrt_rwlock_trywrlock(&rwlock), ffrt_success);
+    EXPECT_EQ(ffrt_rwlock_tryrdlock(&rwlock), ffrt_error_busy);
+    ffrt_rwlock_unlock(&rwlock);
+
+    constexpr int taskNum = 8;
+    constexpr int loopNum = 1000;
+    int a = 0;
+    int b = 0;
+    std::atomic<int> torn = 0;
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&]() {
+            for (int j = 0; j < loopNum; j++) {
+                ffrt_rwlock_rdlock(&rwlock);
+                if (a != b) {
+                    torn++;
+                }
+                ffrt_rwlock_unlock(&rwlock);
+            }
+        });
+        ffrt::submit([&]() {
+            for (int j = 0; j < loopNum / 10; j++) {
+                ffrt_rwlock_wrlock(&rwlock);
+                a++;
+                ffrt::this_task::yield();
+                b++;
+                ffrt_rwlock_unlock(&rwlock);
+            }
+        });
+    }
+    ffrt::wait();
+    EXPECT_EQ(torn, 0);
+    EXPECT_EQ(a, taskNum * loopNum / 10);
+    EXPECT_EQ(b, a);
+
+    ffrt_rwlock_destroy(&rwlock);
+    ffrt_rwlockattr_destroy(&attr);
+}
+
+/*
+ * 测试用例名称：sharedMutexReadBiasedCpp
+ * 测试用例描述：通过属性构造读偏向的ffrt::shared_mutex
+ * 预置条件    ：初始化读偏向的rwlock属性
+ * 操作步骤    ：1.使用该属性构造shared_mutex
+                2.分别加读锁和写锁并尝试加另一种锁
+ * 预期结果    ：读锁与写锁互斥，多个读锁可同时持有
+ */
+HWTEST_F(SyncTest, sharedMutexReadBiasedCpp, TestSize.Level0)
+{
+    ffrt_rwlockattr_t attr;
+    EXPECT_EQ(ffrt_rwlockattr_init(&attr), ffrt_success);
+    EXPECT_EQ(ffrt_rwlockattr_setreadbiased(&attr, true), ffrt_success);
+    ffrt::shared_mutex smtx(attr);
+    ffrt_rwlockattr_destroy(&attr);
+
+    smtx.lock_shared();
+    EXPECT_TRUE(smtx.try_lock_shared());
+    EXPECT_FALSE(smtx.try_lock());
+    smtx.unlock_shared();
+    smtx.unlock_shared();
+    smtx.lock();
+    EXPECT_FALSE(smtx.try_lock_shared());
+    smtx.unlock();
+}
+
 /*
  * 测试用例名称：sharedMutexTest
  * 测试用例描述：legacy任务调用shared_mutex加解锁接口
@@ -848,6 +1283,106 @@ HWTEST_F(SyncTest, future_wait_void, TestSize.Level1)
     t1.join();
 }
 
+/*
+* 测试用例名称：future_then_chain
+* 测试用例描述：测试ffrt::future的then续接
+* 预置条件    ：创建promise并获取future
+* 操作步骤    ：1.在未就绪和已就绪的future上分别串联then续接
+                2.设置promise的值并等待最终结果
+* 预期结果    ：续接按顺序以ffrt任务执行，结果正确，限时等待未就绪的future返回超时
+*/
+HWTEST_F(SyncTest, future_then_chain, TestSize.Level0)
+{
+    ffrt::promise<int> p;
+    std::atomic<bool> inTask {true};
+    ffrt::future<std::string> f = p.get_future()
+        .then([&inTask](int v) {
+            inTask = inTask && ffrt_this_task_get_id() != 0;
+            return v * 2;
+        })
+        .then([](int v) { return std::make_unique<int>(v + 1); })
+        .then([](std::unique_ptr<int> v) { return std::to_string(*v); });
+    EXPECT_EQ(f.wait_for(std::chrono::milliseconds(10)), ffrt::future_status::timeout);
+    p.set_value(20);
+    EXPECT_EQ(f.get(), "41");
+    EXPECT_TRUE(inTask.load());
+
+    ffrt::promise<void> pv;
+    pv.set_value();
+    int called = 0;
+    ffrt::future<void> fv = pv.get_future().then([&called] { called++; });
+    EXPECT_EQ(fv.wait_for(std::chrono::seconds(5)), ffrt::future_status::ready);
+    EXPECT_EQ(called, 1);
+}
+
+/*
+* 测试用例名称：future_wait_for_poll
+* 测试用例描述：测试循环限时等待ffrt::future
+* 预置条件    ：创建promise并获取future
+* 操作步骤    ：1.在任务中延时设置promise的值
+                2.循环调用wait_for直到future就绪
+* 预期结果    ：超时的等待可重复进行，值设置后wait_for返回就绪，结果正确
+*/
+HWTEST_F(SyncTest, future_wait_for_poll, TestSize.Level0)
+{
+    ffrt::promise<int> p;
+    ffrt::future<int> f = p.get_future();
+    ffrt::submit([&p] {
+        ffrt::this_task::sleep_for(std::chrono::milliseconds(50));
+        p.set_value(7);
+    });
+    int timeoutCnt = 0;
+    while (f.wait_for(std::chrono::milliseconds(1)) == ffrt::future_status::timeout) {
+        timeoutCnt++;
+    }
+    EXPECT_GT(timeoutCnt, 0);
+    EXPECT_EQ(f.wait_until(std::chrono::steady_clock::now()), ffrt::future_status::ready);
+    EXPECT_EQ(f.get(), 7);
+    ffrt::wait();
+}
+
+/*
+* 测试用例名称：future_when_all_any
+* 测试用例描述：测试ffrt::when_all和ffrt::when_any组合多个future
+* 预置条件    ：创建多个promise并获取future
+* 操作步骤    ：1.对一组future调用when_all，对另一组调用when_any
+                2.在ffrt任务中乱序设置promise的值
+* 预期结果    ：when_all按输入顺序返回全部结果，when_any返回第一个就绪的下标和值
+*/
+HWTEST_F(SyncTest, future_when_all_any, TestSize.Level0)
+{
+    constexpr int num = 8;
+    std::vector<ffrt::promise<int>> promises(num);
+    std::vector<ffrt::future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+    ffrt::future<std::vector<int>> all = ffrt::when_all(std::move(futures));
+    for (int i = num - 1; i >= 0; i--) {
+        ffrt::submit([&promises, i] { promises[i].set_value(i * i); });
+    }
+    std::vector<int> values = all.get();
+    ASSERT_EQ(values.size(), num);
+    for (int i = 0; i < num; i++) {
+        EXPECT_EQ(values[i], i * i);
+    }
+    ffrt::wait();
+
+    std::vector<ffrt::promise<void>> voids(2);
+    std::vector<ffrt::future<void>> voidFutures;
+    for (auto& p : voids) {
+        voidFutures.push_back(p.get_future());
+    }
+    ffrt::future<size_t> any = ffrt::when_any(std::move(voidFutures));
+    voids[1].set_value();
+    EXPECT_EQ(any.get(), 1);
+    voids[0].set_value();
+
+    ffrt::future<void> none = ffrt::when_all(std::vector<ffrt::future<void>> {});
+    EXPECT_EQ(none.wait_for(std::chrono::milliseconds(0)), ffrt::future_status::ready);
+    EXPECT_FALSE(ffrt::when_any(std::vector<ffrt::future<int>> {}).valid());
+}
+
 /*
 * 测试用例名称：ffrt_sleep_test
 * 测试用例描述：测试ffrt_usleep接口
@@ -908,3 +1443,251 @@ HWTEST_F(SyncTest, rwlock_api_test, TestSize.Level0)
     x = ffrt_rwlock_destroy(nullptr);
     EXPECT_EQ(x, ffrt_error_inval);
 }
+
+/*
+* 测试用例名称：channel_send_recv
+* 测试用例描述：测试ffrt::channel在任务间传递数据
+* 预置条件    ：创建容量为2的channel
+* 操作步骤    ：1.提交生产者任务发送100个数据后关闭channel
+                2.提交消费者任务接收数据直至channel关闭
+* 预期结果    ：数据按序全部接收，关闭后发送失败
+*/
+HWTEST_F(SyncTest, channel_send_recv, TestSize.Level0)
+{
+    ffrt::channel<std::unique_ptr<int>> ch(2);
+    constexpr int itemNum = 100;
+    int sum = 0;
+    bool ordered = true;
+
+    ffrt::submit([ch]() mutable {
+        for (int i = 0; i < itemNum; i++) {
+            ch.send(std::make_unique<int>(i));
+        }
+        ch.close();
+    });
+    ffrt::submit([ch, &sum, &ordered]() mutable {
+        int expect = 0;
+        while (auto item = ch.recv()) {
+            ordered = ordered && (**item == expect++);
+            sum += **item;
+        }
+    });
+    ffrt::wait();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(sum, itemNum * (itemNum - 1) / 2);
+    EXPECT_FALSE(ch.send(std::make_unique<int>(0)));
+    EXPECT_FALSE(ch.try_recv().has_value());
+}
+
+/*
+* 测试用例名称：channel_queue_pipeline
+* 测试用例描述：测试ffrt::channel绑定串行队列作为消费者
+* 预置条件    ：创建两个串行队列，channel绑定到第二个队列
+* 操作步骤    ：1.在第一个队列的任务中向channel发送数据
+                2.等待第二个队列处理完全部数据
+* 预期结果    ：第二个队列按序处理全部数据，重复绑定失败
+*/
+HWTEST_F(SyncTest, channel_queue_pipeline, TestSize.Level0)
+{
+    ffrt::queue stage1("channel_stage1");
+    ffrt::queue stage2("channel_stage2");
+    ffrt::channel<int> ch(4);
+    constexpr int itemNum = 100;
+    std::vector<int> received;
+
+    EXPECT_TRUE(ch.bind(stage2, [&received](int&& value) { received.push_back(value); }));
+    EXPECT_FALSE(ch.bind(stage2, [](int&&) {}));
+
+    ffrt::task_handle handle = stage1.submit_h([ch]() mutable {
+        for (int i = 0; i < itemNum; i++) {
+            ch.send(i);
+        }
+    });
+    stage1.wait(handle);
+    while (ch.size() > 0) {
+        usleep(1000);
+    }
+    stage2.wait(stage2.submit_h([] {}));
+
+    ASSERT_EQ(received.size(), itemNum);
+    for (int i = 0; i < itemNum; i++) {
+        EXPECT_EQ(received[i], i);
+    }
+}
+
+/*
+* 测试用例名称：semaphore_acquire_release
+* 测试用例描述：测试ffrt::counting_semaphore限制并发任务数
+* 预置条件    ：创建初始许可为2的信号量
+* 操作步骤    ：1.提交20个任务，每个任务获取许可后执行并释放
+                2.统计同时持有许可的任务数
+* 预期结果    ：同时持有许可的任务数不超过2，空指针接口返回失败
+*/
+HWTEST_F(SyncTest, semaphore_acquire_release, TestSize.Level0)
+{
+    constexpr int permitNum = 2;
+    constexpr int taskNum = 20;
+    ffrt::counting_semaphore<> sem(permitNum);
+    std::atomic<int> inside {0};
+    std::atomic<int> maxInside {0};
+
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&]() {
+            sem.acquire();
+            int cur = ++inside;
+            int prev = maxInside.load();
+            while (cur > prev && !maxInside.compare_exchange_weak(prev, cur)) {
+            }
+            ffrt::this_task::sleep_for(std::chrono::milliseconds(1));
+            inside--;
+            sem.release();
+        });
+    }
+    ffrt::wait();
+    EXPECT_LE(maxInside.load(), permitNum);
+
+    ffrt::binary_semaphore done(0);
+    EXPECT_FALSE(done.try_acquire());
+    std::thread t([&done]() { done.release(); });
+    done.acquire();
+    t.join();
+
+    EXPECT_EQ(ffrt_sem_init(nullptr, 0), ffrt_error_inval);
+    EXPECT_EQ(ffrt_sem_post(nullptr, 1), ffrt_error_inval);
+    EXPECT_EQ(ffrt_sem_wait(nullptr), ffrt_error_inval);
+    EXPECT_EQ(ffrt_sem_trywait(nullptr), ffrt_error_inval);
+    EXPECT_EQ(ffrt_sem_destroy(nullptr), ffrt_error_inval);
+}
+
+/*
+* 测试用例名称：latch_count_down
+* 测试用例描述：测试ffrt::latch等待所有任务完成
+* 预置条件    ：创建计数为任务数的latch
+* 操作步骤    ：1.提交多个任务，每个任务完成后count_down
+                2.主线程和一个任务同时等待latch
+* 预期结果    ：latch归零后等待者全部返回，且看到所有任务的结果
+*/
+HWTEST_F(SyncTest, latch_count_down, TestSize.Level0)
+{
+    constexpr int taskNum = 10;
+    ffrt::latch done(taskNum);
+    std::atomic<int> sum {0};
+    std::atomic<bool> waiterSeen {false};
+
+    EXPECT_FALSE(done.try_wait());
+    ffrt::submit([&]() {
+        done.wait();
+        waiterSeen = (sum.load() == taskNum);
+    });
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&]() {
+            sum++;
+            done.count_down();
+        });
+    }
+    done.wait();
+    EXPECT_TRUE(done.try_wait());
+    EXPECT_EQ(sum.load(), taskNum);
+    ffrt::wait();
+    EXPECT_TRUE(waiterSeen.load());
+
+    ffrt_latch_t latch;
+    EXPECT_EQ(ffrt_latch_init(&latch, 1), ffrt_success);
+    EXPECT_EQ(ffrt_latch_try_wait(&latch), ffrt_error_busy);
+    EXPECT_EQ(ffrt_latch_arrive_and_wait(&latch, 1), ffrt_success);
+    EXPECT_EQ(ffrt_latch_destroy(&latch), ffrt_success);
+    EXPECT_EQ(ffrt_latch_init(nullptr, 1), ffrt_error_inval);
+    EXPECT_EQ(ffrt_latch_wait(nullptr), ffrt_error_inval);
+}
+
+/*
+* 测试用例名称：barrier_phases
+* 测试用例描述：测试ffrt::barrier在多轮阶段间同步任务
+* 预置条件    ：创建参与者数为任务数的barrier
+* 操作步骤    ：1.每个任务执行多轮，每轮写入自己的数据后arrive_and_wait
+                2.最后一个任务提前arrive_and_drop退出
+* 预期结果    ：每轮结束时所有参与者的数据都已写入，退出后剩余任务仍能继续同步
+*/
+HWTEST_F(SyncTest, barrier_phases, TestSize.Level0)
+{
+    constexpr int taskNum = 4;
+    constexpr int roundNum = 50;
+    ffrt::barrier sync(taskNum);
+    std::atomic<int> arrived[roundNum] = {};
+    std::atomic<bool> ordered {true};
+
+    for (int i = 0; i < taskNum - 1; i++) {
+        ffrt::submit([&]() {
+            for (int r = 0; r < roundNum; r++) {
+                arrived[r]++;
+                sync.arrive_and_wait();
+                int expect = r == 0 ? taskNum : taskNum - 1;
+                if (arrived[r].load() != expect) {
+                    ordered = false;
+                }
+            }
+        });
+    }
+    ffrt::submit([&]() {
+        arrived[0]++;
+        sync.arrive_and_drop();
+    });
+    ffrt::wait();
+    EXPECT_TRUE(ordered.load());
+
+    ffrt_barrier_t barrier;
+    EXPECT_EQ(ffrt_barrier_init(&barrier, 0), ffrt_error_inval);
+    EXPECT_EQ(ffrt_barrier_init(&barrier, 1), ffrt_success);
+    EXPECT_EQ(ffrt_barrier_arrive_and_wait(&barrier), ffrt_success);
+    EXPECT_EQ(ffrt_barrier_destroy(&barrier), ffrt_success);
+    EXPECT_EQ(ffrt_barrier_arrive_and_wait(nullptr), ffrt_error_inval);
+}
+
+/*
+* 测试用例名称：call_once_concurrent
+* 测试用例描述：测试ffrt::call_once和ffrt::lazy在并发任务中只初始化一次
+* 预置条件    ：创建once_flag和lazy对象
+* 操作步骤    ：1.提交多个任务同时调用call_once，初始化函数中睡眠以制造等待者
+                2.多个任务和线程同时访问lazy对象
+* 预期结果    ：初始化函数只执行一次，所有调用者返回时都能看到初始化结果
+*/
+HWTEST_F(SyncTest, call_once_concurrent, TestSize.Level0)
+{
+    constexpr int taskNum = 16;
+    ffrt::once_flag flag;
+    std::atomic<int> initNum {0};
+    int value = 0;
+    std::atomic<int> seen {0};
+
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&]() {
+            ffrt::call_once(flag, [&](int v) {
+                initNum++;
+                ffrt::this_task::sleep_for(std::chrono::milliseconds(10));
+                value = v;
+            }, 42);
+            if (value == 42) {
+                seen++;
+            }
+        });
+    }
+    ffrt::wait();
+    EXPECT_EQ(initNum.load(), 1);
+    EXPECT_EQ(seen.load(), taskNum);
+
+    std::atomic<int> factoryNum {0};
+    ffrt::lazy<std::vector<int>> table([&factoryNum] {
+        factoryNum++;
+        return std::vector<int>(100, 1);
+    });
+    std::atomic<int> sizeSum {0};
+    for (int i = 0; i < taskNum; i++) {
+        ffrt::submit([&]() { sizeSum += table->size(); });
+    }
+    std::thread t([&]() { sizeSum += (*table).size(); });
+    ffrt::wait();
+    t.join();
+    EXPECT_EQ(factoryNum.load(), 1);
+    EXPECT_EQ(sizeSum.load(), (taskNum + 1) * 100);
+}
@@ -296,8 +296,8 @@ struct UvQueue {
 // libuv's uv__queue_empty
 inline int UvQueueEmpty(const struct UvQueue* q)
 {
-    std::lock_guard lg(ffrt::FFRTFacade::GetScheduler().GetScheduler(ffrt::qos_user_initiated).uvMtx);
-    return q == q->next || q != q->next->prev;
+    UvQueue* next = __atomic_load_n(&q->next, __ATOMIC_SEQ_CST);
+    return q == next || q != __atomic_load_n(&next->prev, __ATOMIC_SEQ_CST);
 }
 
 void UVCbSleep(ffrt_executor_task_t* data, ffrt_qos_t qos)
@@ -516,6 +516,80 @@ HWTEST_F(DependencyTest, uv_task_block_ffrt_mutex, TestSize.Level0)
     t2.join();
 }
 
+namespace {
+std::atomic_int uv_running = 0;
+std::atomic_int uv_max_running = 0;
+std::atomic_int uv_done = 0;
+std::atomic<bool> uv_hold = false;
+void UVCountRunning(ffrt_executor_task_t* data, ffrt_qos_t qos)
+{
+    (void)data;
+    (void)qos;
+    int running = uv_running.fetch_add(1) + 1;
+    int maxRunning = uv_max_running.load();
+    while (running > maxRunning && !uv_max_running.compare_exchange_weak(maxRunning, running)) {
+    }
+    do {
+        usleep(1000);
+    } while (uv_hold.load());
+    uv_running.fetch_sub(1);
+    uv_done.fetch_add(1);
+}
+}
+
+/*
+ * 测试用例名称 ：executor_task_set_max_concurrency
+ * 测试用例描述 ：测试设置uv任务并发上限，以及取消等待中的uv任务
+ * 操作步骤     ：1.传入非法参数设置并发上限
+ *               2.设置并发上限为2，提交批量uv任务
+ *               3.设置并发上限为1，阻塞正在执行的uv任务，取消等待中的uv任务
+ * 预期结果     ：非法参数返回ffrt_error_inval，同时执行的uv任务数不超过上限，等待中的uv任务只能被取消一次
+ */
+HWTEST_F(DependencyTest, executor_task_set_max_concurrency, TestSize.Level1)
+{
+    constexpr int taskCount = 50;
+    constexpr uint32_t defaultConcurrency = 8;
+    EXPECT_EQ(ffrt_executor_task_set_max_concurrency(ffrt_qos_user_initiated, 0), ffrt_error_inval);
+    EXPECT_EQ(ffrt_executor_task_set_max_concurrency(ffrt::qos_max + 1, 1), ffrt_error_inval);
+
+    uv_running = 0;
+    uv_max_running = 0;
+    uv_done = 0;
+    ffrt_executor_task_register_func(UVCountRunning, ffrt_uv_task);
+    ffrt_task_attr_t attr;
+    ffrt_task_attr_init(&attr);
+    ffrt_task_attr_set_qos(&attr, ffrt_qos_user_initiated);
+    EXPECT_EQ(ffrt_executor_task_set_max_concurrency(ffrt_qos_user_initiated, 2), ffrt_success);
+    static ffrt_executor_task_t works[taskCount];
+    for (int i = 0; i < taskCount; i++) {
+        ffrt_executor_task_submit(&works[i], &attr);
+    }
+    while (uv_done < taskCount) {
+        usleep(1000);
+    }
+    EXPECT_LE(uv_max_running.load(), 2);
+
+    EXPECT_EQ(ffrt_executor_task_set_max_concurrency(ffrt_qos_user_initiated, 1), ffrt_success);
+    uv_done = 0;
+    uv_hold = true;
+    ffrt_executor_task_submit(&works[0], &attr);
+    while (uv_running < 1) {
+        usleep(100);
+    }
+    ffrt_executor_task_submit(&works[1], &attr);
+    EXPECT_EQ(ffrt_executor_task_cancel(&works[1], ffrt_qos_user_initiated), 1);
+    EXPECT_EQ(ffrt_executor_task_cancel(&works[1], ffrt_qos_user_initiated), 0);
+    EXPECT_EQ(ffrt_executor_task_cancel(&works[0], ffrt_qos_user_initiated), 0);
+    uv_hold = false;
+    while (uv_done < 1) {
+        usleep(1000);
+    }
+    usleep(10000);
+    EXPECT_EQ(uv_done.load(), 1);
+    EXPECT_EQ(ffrt_executor_task_set_max_concurrency(ffrt_qos_user_initiated, defaultConcurrency), ffrt_success);
+    ffrt_task_attr_destroy(&attr);
+}
+
 HWTEST_F(DependencyTest, onsubmit_test, TestSize.Level0)
 {
     ffrt_task_handle_t handle = nullptr;
@@ -13,6 +13,10 @@
  * limitations under the License.
  */
 
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include "ffrt_inner.h"
 #include "../common.h"
@@ -160,4 +164,77 @@ HWTEST_F(DumpTest, dump_thre_failed, TestSize.Level1)
     ffrt_task_timeout_set_threshold(500);
     uint32_t ret = ffrt_task_timeout_get_threshold();
     EXPECT_NE(ret, 500);
-}
\ No newline at end of file
+}
+
+/*
+ * 测试用例名称 ：dump_lock_contention_succ
+ * 测试用例描述：获取锁竞争采样信息成功
+ * 操作步骤    ：1、设置采样率为1，多个线程竞争同一个mutex
+ *             2、调用函数ffrt_dump获取锁竞争信息
+ * 预期结果    ：dump信息中包含该mutex的记录
+ */
+HWTEST_F(DumpTest, dump_lock_contention_succ, TestSize.Level1)
+{
+    ffrt_lock_profile_set_sample_rate(1);
+    ffrt::mutex mtx;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&mtx] {
+            for (int j = 0; j < 50; j++) {
+                mtx.lock();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                mtx.unlock();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    char dumpinfo[1024 * 64] = {0};
+    int ret = ffrt_dump(DUMP_LOCK_CONTENTION_INFO, dumpinfo, 1024 * 64);
+    EXPECT_GT(ret, 0);
+    std::ostringstream lockAddr;
+    lockAddr << "0x" << std::hex << reinterpret_cast<uintptr_t>(&mtx) << " mutex";
+    EXPECT_NE(std::string(dumpinfo).find(lockAddr.str()), std::string::npos);
+    ffrt_lock_profile_set_sample_rate(64);
+}
+
+/*
+ * 测试用例名称 ：dump_lock_contention_cond_idle
+ * 测试用例描述：条件变量等待通知的时间记为空闲时间，不计入锁竞争
+ * 操作步骤    ：1、设置采样率为1，线程等待条件变量直到另一个线程通知
+ *             2、调用函数ffrt_dump获取锁竞争信息
+ * 预期结果    ：条件变量只出现在空闲时间记录中
+ */
+HWTEST_F(DumpTest, dump_lock_contention_cond_idle, TestSize.Level1)
+{
+    ffrt_lock_profile_set_sample_rate(1);
+    ffrt::mutex mtx;
+    ffrt::condition_variable cv;
+    bool ready = false;
+    std::thread waiter([&] {
+        std::unique_lock lk(mtx);
+        cv.wait(lk, [&ready] { return ready; });
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        std::lock_guard lk(mtx);
+        ready = true;
+    }
+    cv.notify_one();
+    waiter.join();
+
+    char dumpinfo[1024 * 64] = {0};
+    int ret = ffrt_dump(DUMP_LOCK_CONTENTION_INFO, dumpinfo, 1024 * 64);
+    EXPECT_GT(ret, 0);
+    std::string info(dumpinfo);
+    std::ostringstream condAddr;
+    condAddr << "0x" << std::hex << reinterpret_cast<uintptr_t>(&cv) << " cond";
+    size_t idlePos = info.find("condition wait idle");
+    ASSERT_NE(idlePos, std::string::npos);
+    size_t condPos = info.find(condAddr.str());
+    EXPECT_NE(condPos, std::string::npos);
+    EXPECT_GT(condPos, idlePos);
+    ffrt_lock_profile_set_sample_rate(64);
+}
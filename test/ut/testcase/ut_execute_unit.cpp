@@ -26,6 +26,7 @@
 #include "sched/stask_scheduler.h"
 #include "util/capability.h"
 #include "util/worker_monitor.h"
+#include "util/ffrt_facade.h"
 #include "../common.h"
 
 using namespace std;
@@ -154,6 +155,75 @@ HWTEST_F(ExecuteUnitTest, ffrt_escape_submit_execute, TestSize.Level0)
     manager->ReportEscapeEvent(qos_default, 1);
 }
 
+/*
+ * 测试用例名称：ffrt_pressure_scaling_adjust
+ * 测试用例描述：根据CPU压力调整worker的最大并发数
+ * 预置条件    ：获取当前的EU
+ * 操作步骤    ：1.传入非法参数使能压力调节
+ *              2.依次传入高压力、runqueue未超过CPU数、低压力的采样结果
+ *              3.降低并发数后由用户修改最大并发数，再恢复并发数
+ * 预期结果    ：非法参数使能失败，高压力时最大并发数逐步降低，低压力时逐步恢复到初始值，用户设置的并发数不被恢复覆盖
+ */
+HWTEST_F(ExecuteUnitTest, ffrt_pressure_scaling_adjust, TestSize.Level0)
+{
+    EXPECT_EQ(ffrt_enable_worker_pressure_scaling(1, 20), 1);
+    EXPECT_EQ(ffrt_enable_worker_pressure_scaling(100, 0), 1);
+    EXPECT_EQ(ffrt_enable_worker_pressure_scaling(100, 101), 1);
+    // the pressure stall information may be missing on the device
+    if (ffrt_enable_worker_pressure_scaling(10, 20) == 0) {
+        EXPECT_EQ(ffrt_enable_worker_pressure_scaling(10, 20), 1);
+        usleep(50000);
+        ffrt_disable_worker_pressure_scaling();
+    }
+
+    ExecuteUnit& eu = FFRTFacade::GetExecuteUnit();
+    std::lock_guard lk(eu.pressureMutex);
+    size_t maxConcurrency[QoS::MaxNum()];
+    for (auto qos = QoS::Min(); qos < QoS::Max(); ++qos) {
+        maxConcurrency[qos] = eu.workerGroup[qos].maxConcurrency;
+        eu.baseConcurrency[qos] = maxConcurrency[qos];
+        eu.scaledConcurrency[qos] = maxConcurrency[qos];
+    }
+    uint32_t stallThresholdPct = eu.pressureConfig.stallThresholdPct_;
+    eu.pressureConfig.stallThresholdPct_ = 20;
+    // no task of this qos runs during the test, so its executing num is left to the test
+    CPUWorkerGroup& group = eu.workerGroup[qos_user_interactive];
+    int executingNum = group.executingNum;
+    group.maxConcurrency = 16;
+    group.executingNum = 16;
+    eu.baseConcurrency[qos_user_interactive] = 16;
+    eu.scaledConcurrency[qos_user_interactive] = 16;
+
+    eu.AdjustConcurrencyByPressure({50, 8, 4});
+    EXPECT_EQ(group.maxConcurrency, 12);
+    eu.AdjustConcurrencyByPressure({50, 8, 4});
+    EXPECT_EQ(group.maxConcurrency, 9);
+    // the stall alone is not an oversubscription while the cpus can take every runnable task
+    eu.AdjustConcurrencyByPressure({50, 2, 4});
+    EXPECT_EQ(group.maxConcurrency, 9);
+    eu.AdjustConcurrencyByPressure({0, 0, 4});
+    EXPECT_EQ(group.maxConcurrency, 11);
+    eu.AdjustConcurrencyByPressure({0, 0, 4});
+    EXPECT_EQ(group.maxConcurrency, 13);
+    eu.AdjustConcurrencyByPressure({0, 0, 4});
+    EXPECT_EQ(group.maxConcurrency, 16);
+
+    // a limit set by the user while scaling is on is neither scaled back up nor restored
+    eu.AdjustConcurrencyByPressure({50, 8, 4});
+    EXPECT_EQ(group.maxConcurrency, 12);
+    group.maxConcurrency = 6;
+    eu.AdjustConcurrencyByPressure({0, 0, 4});
+    EXPECT_EQ(group.maxConcurrency, 6);
+    eu.RestoreConcurrency();
+    EXPECT_EQ(group.maxConcurrency, 6);
+
+    group.executingNum = executingNum;
+    eu.pressureConfig.stallThresholdPct_ = stallThresholdPct;
+    for (auto qos = QoS::Min(); qos < QoS::Max(); ++qos) {
+        eu.workerGroup[qos].maxConcurrency = maxConcurrency[qos];
+    }
+}
+
 /*
 * 测试用例名称：ffrt_inc_worker_abnormal
 * 测试用例描述：调用EU的IncWorker函数
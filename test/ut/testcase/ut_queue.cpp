@@ -15,6 +15,8 @@
 
 #include <thread>
 #include <chrono>
+#include <set>
+#include <regex>
 #include <gtest/gtest.h>
 #include "ffrt_inner.h"
 #include "c/queue_ext.h"
@@ -24,6 +26,7 @@
 #define private public
 #include "queue/queue_monitor.h"
 #undef private
+#include "queue/eventhandler_adapter_queue.h"
 #include "util/spmc_queue.h"
 #include "util/ffrt_facade.h"
 #include "util/white_list.h"
@@ -1694,6 +1697,192 @@ HWTEST_F(QueueTest, ffrt_eventhandler_adapter_queue_get_task_cnt, TestSize.Level
     testQueue = nullptr;
 }
 
+/*
+ * 测试用例名称 : ffrt_eventhandler_adapter_queue_dump_history
+ * 测试用例描述 : eventhandler adapter队列dump历史任务信息
+ * 预置条件     ：创建一个eventhandler adapter队列
+ * 操作步骤     : 1、提交超过历史记录容量的具名任务，以及一个超长名称任务和一个无名称任务
+ *               2、等待任务执行完成后调用ffrt_queue_dump
+ * 预期结果    : 1、只保留最近的历史任务，最早的任务被覆盖
+ *              2、任务名按queueName[_taskName]_gid格式重建，超长名称完整保留
+ */
+HWTEST_F(QueueTest, ffrt_eventhandler_adapter_queue_dump_history, TestSize.Level0)
+{
+    ffrt_queue_attr_t queue_attr;
+    (void)ffrt_queue_attr_init(&queue_attr);
+    ffrt_queue_t queue_handle = ffrt_queue_create(
+        static_cast<ffrt_queue_type_t>(ffrt_queue_eventhandler_adapter), "dump_queue", &queue_attr);
+
+    std::function<void()> emptyFunc = []() {};
+    ffrt_task_attr_t task_attr;
+    ffrt_task_attr_init(&task_attr);
+    for (int i = 0; i < 40; i++) {
+        std::string name = "hist_" + std::to_string(i);
+        ffrt_task_attr_set_name(&task_attr, name.c_str());
+        ffrt_queue_submit(queue_handle, create_function_wrapper(emptyFunc, ffrt_function_kind_queue), &task_attr);
+    }
+    std::string longName(256, 'x');
+    ffrt_task_attr_set_name(&task_attr, (longName + "_tail").c_str());
+    ffrt_queue_submit(queue_handle, create_function_wrapper(emptyFunc, ffrt_function_kind_queue), &task_attr);
+    ffrt_queue_submit(queue_handle, create_function_wrapper(emptyFunc, ffrt_function_kind_queue), nullptr);
+    // the last task is recorded only after it returns, so wait for one more
+    ffrt_task_attr_set_name(&task_attr, "sentinel");
+    ffrt_task_handle_t handle = ffrt_queue_submit_h(queue_handle,
+        create_function_wrapper(emptyFunc, ffrt_function_kind_queue), &task_attr);
+    ffrt_queue_wait(handle);
+
+    std::vector<char> buf(64 * 1024);
+    EXPECT_GT(ffrt_queue_dump(queue_handle, "eh", buf.data(), buf.size(), true), 0);
+    std::string dump(buf.data());
+    // the queue name gets the queue id appended: sq_dump_queue_<id>[_taskName]_gid
+    auto hasTask = [&dump](const std::string& name) {
+        return std::regex_search(dump, std::regex("task name = sq_dump_queue_[0-9]+" + name + "_[0-9]+ \\}"));
+    };
+    for (int i = 0; i < 10; i++) {
+        EXPECT_FALSE(hasTask("_hist_" + std::to_string(i)));
+    }
+    for (int i = 12; i < 40; i++) {
+        EXPECT_TRUE(hasTask("_hist_" + std::to_string(i)));
+    }
+    EXPECT_TRUE(hasTask("_" + longName + "_tail"));
+    EXPECT_TRUE(hasTask(""));
+
+    ffrt_task_handle_destroy(handle);
+    ffrt_task_attr_destroy(&task_attr);
+    ffrt_queue_attr_destroy(&queue_attr);
+    ffrt_queue_destroy(queue_handle);
+}
+
+/*
+ * 测试用例名称 : ffrt_history_task_slot_concurrent_store
+ * 测试用例描述 : 历史任务记录槽位并发写入
+ * 操作步骤     : 1、两个线程向同一个槽位反复写入各自的完整记录
+ *               2、同时另一个线程反复读取该槽位
+ * 预期结果    : 读到的每条记录都完整来自同一次写入
+ */
+HWTEST_F(QueueTest, ffrt_history_task_slot_concurrent_store, TestSize.Level1)
+{
+    ffrt::HistoryTaskSlot slot;
+    std::atomic<bool> stop = false;
+    ffrt::HistoryTaskName* names[] = {
+        nullptr, new ffrt::HistoryTaskName("slot_1"), new ffrt::HistoryTaskName("slot_2")
+    };
+    auto writer = [&slot, &stop, &names](uint64_t id) {
+        ffrt::HistoryTask task;
+        task.senderKernelThreadId_ = static_cast<int32_t>(id);
+        task.taskName_ = names[id];
+        task.gid_ = task.sendTime_ = task.handleTime_ = task.beginTime_ = task.triggerTime_ = task.completeTime_ = id;
+        while (!stop.load()) {
+            slot.Store(task);
+        }
+    };
+    std::thread writer1(writer, 1);
+    std::thread writer2(writer, 2);
+
+    for (int i = 0; i < 100000; i++) {
+        slot.Load([&names](const ffrt::HistoryTask& task) {
+            if (task.senderKernelThreadId_ == 0) {
+                return;
+            }
+            uint64_t id = static_cast<uint64_t>(task.senderKernelThreadId_);
+            EXPECT_EQ(task.taskName_, names[id]);
+            EXPECT_EQ(task.taskName_->Str(), "slot_" + std::to_string(id));
+            EXPECT_EQ(task.gid_, id);
+            EXPECT_EQ(task.completeTime_, id);
+        });
+        if (i % 100 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    writer1.join();
+    writer2.join();
+    // the slot keeps its own reference to the last name stored
+    names[1]->DecRef();
+    names[2]->DecRef();
+}
+
+/*
+ * 测试用例名称 : ffrt_concurrent_queue_priority_task_cnt
+ * 测试用例描述 : 并行队列多优先级任务计数与出队
+ * 预置条件     ：创建一个并发度为1的并行队列
+ * 操作步骤     : 1、提交不同优先级的延时任务，调用get_task_cnt接口
+ *               2、取消其中一个延时任务，再次调用get_task_cnt接口
+ *               3、提交一个immediate优先级的非延时任务并等待
+ * 预期结果    : 1、get_task_cnt返回提交的任务数
+ *              2、取消后get_task_cnt减1
+ *              3、非延时任务先于延时任务执行，get_task_cnt不变
+ */
+HWTEST_F(QueueTest, ffrt_concurrent_queue_priority_task_cnt, TestSize.Level0)
+{
+    queue* testQueue = new queue(queue_concurrent, "test_queue", queue_attr().max_concurrency(1));
+    const ffrt_queue_priority_t prios[] = {ffrt_queue_priority_immediate, ffrt_queue_priority_high,
+        ffrt_queue_priority_low, ffrt_queue_priority_idle};
+    std::vector<task_handle> handles;
+    for (auto prio : prios) {
+        handles.emplace_back(testQueue->submit_h([] {}, task_attr().priority(prio).delay(10 * 1000 * 1000)));
+        EXPECT_EQ(testQueue->get_task_cnt(), handles.size());
+    }
+
+    EXPECT_EQ(testQueue->cancel(handles.back()), 0);
+    EXPECT_EQ(testQueue->get_task_cnt(), 3);
+
+    int result = 0;
+    task_handle handle = testQueue->submit_h([&result] { OnePlusForTest(static_cast<void*>(&result)); },
+        task_attr().priority(ffrt_queue_priority_immediate));
+    testQueue->wait(handle);
+    EXPECT_EQ(result, 1);
+    EXPECT_EQ(testQueue->get_task_cnt(), 3);
+
+    delete testQueue;
+}
+
+/*
+ * 测试用例名称 : ffrt_queue_timeout_sweep_multi_task
+ * 测试用例描述 : 设置超时的串行队列中多个任务执行超时
+ * 预置条件     ：创建设置了timeout与超时回调的串行队列
+ * 操作步骤     : 1、依次提交超时任务与非超时任务
+ *               2、等待任务执行完成及超时回调执行后销毁队列
+ * 预期结果    : 任务全部执行，每个超时任务恰好触发一次超时回调，非超时任务不触发
+ */
+HWTEST_F(QueueTest, ffrt_queue_timeout_sweep_multi_task, TestSize.Level1)
+{
+    ffrt_queue_attr_t queue_attr;
+    (void)ffrt_queue_attr_init(&queue_attr);
+    ffrt_queue_attr_set_timeout(&queue_attr, 50000);
+    std::atomic<int> timeoutCnt = 0;
+    std::function<void()> timeoutCb = [&timeoutCnt]() { timeoutCnt++; };
+    ffrt_queue_attr_set_callback(&queue_attr, ffrt::create_function_wrapper(timeoutCb, ffrt_function_kind_queue));
+    ffrt_queue_t queue_handle = ffrt_queue_create(ffrt_queue_serial, "test_queue", &queue_attr);
+
+    std::atomic<int> result = 0;
+    std::function<void()> slowFunc = [&result]() {
+        usleep(200000);
+        result++;
+    };
+    std::function<void()> fastFunc = [&result]() { result++; };
+    const int slowTaskNum = 2;
+    for (int i = 0; i < slowTaskNum; i++) {
+        ffrt_queue_submit(queue_handle, create_function_wrapper(slowFunc, ffrt_function_kind_queue), nullptr);
+        ffrt_queue_submit(queue_handle, create_function_wrapper(fastFunc, ffrt_function_kind_queue), nullptr);
+    }
+    ffrt_task_handle_t handle =
+        ffrt_queue_submit_h(queue_handle, create_function_wrapper(fastFunc, ffrt_function_kind_queue), nullptr);
+    ffrt_queue_wait(handle);
+    EXPECT_EQ(result, 5);
+
+    // the callbacks are run asynchronously, wait for them and a bit longer to catch a repeated report
+    for (int i = 0; i < 100 && timeoutCnt < slowTaskNum; i++) {
+        usleep(10000);
+    }
+    usleep(100000);
+    EXPECT_EQ(timeoutCnt, slowTaskNum);
+
+    ffrt_task_handle_destroy(handle);
+    ffrt_queue_attr_destroy(&queue_attr);
+    ffrt_queue_destroy(queue_handle);
+}
+
 /*
 * 测试用例名称：queuetask_timeout_trigger_succ
 * 测试用例描述：主动设置timeout的队列任务超时执行回调
@@ -1889,4 +2078,66 @@ HWTEST_F(QueueTest, ffrt_queue_task_double_execute, TestSize.Level0)
 
     ffrt_queue_attr_destroy(&queue_attr);
     ffrt_queue_destroy(queue_handle);
-}
\ No newline at end of file
+}
+
+/* 测试用例名称：ffrt_serial_queue_run_budget
+ * 测试用例描述：测试串行队列设置运行预算后在同一次调度中连续执行任务
+ * 预置条件    ：创建串行队列，设置运行预算为4个任务
+ * 操作步骤    ：1、提交一个任务，每个任务执行时提交下一个任务，共16个任务
+                2、记录每个任务执行时的调度任务
+                3、等待全部任务执行完成
+ * 预期结果    ：任务按序执行，每次调度连续执行不超过4个任务
+ */
+HWTEST_F(QueueTest, ffrt_serial_queue_run_budget, TestSize.Level0)
+{
+    constexpr uint32_t budgetTaskNum = 4;
+    constexpr int taskNum = 16;
+    ffrt_queue_attr_t queue_attr;
+    (void)ffrt_queue_attr_init(&queue_attr);
+    ffrt_queue_attr_set_run_budget(&queue_attr, budgetTaskNum, 0);
+    EXPECT_EQ(ffrt_queue_attr_get_run_budget_task_num(&queue_attr), budgetTaskNum);
+    EXPECT_EQ(ffrt_queue_attr_get_run_budget_time(&queue_attr), 0);
+    ffrt_queue_t queue_handle = ffrt_queue_create(ffrt_queue_serial, "test_queue", &queue_attr);
+
+    std::vector<int> order;
+    std::set<uint64_t> schedTasks;
+    ffrt_task_handle_t lastHandle = nullptr;
+    ffrt::mutex mtx;
+    ffrt::condition_variable cv;
+    std::function<void(int)> submitNext = [&](int idx) {
+        std::function<void()> func = [&, idx]() {
+            order.push_back(idx);
+            schedTasks.insert(ExecuteCtx::Cur()->task->gid);
+            if (idx + 1 < taskNum) {
+                submitNext(idx + 1);
+            }
+        };
+        ffrt_task_handle_t h =
+            ffrt_queue_submit_h(queue_handle, create_function_wrapper(func, ffrt_function_kind_queue), nullptr);
+        if (idx + 1 == taskNum) {
+            std::lock_guard lock(mtx);
+            lastHandle = h;
+            cv.notify_one();
+        } else {
+            ffrt_task_handle_destroy(h);
+        }
+    };
+    submitNext(0);
+    {
+        std::unique_lock lock(mtx);
+        cv.wait(lock, [&] { return lastHandle != nullptr; });
+    }
+    ffrt_queue_wait(lastHandle);
+    ffrt_task_handle_destroy(lastHandle);
+
+    ASSERT_EQ(order.size(), taskNum);
+    for (int i = 0; i < taskNum; i++) {
+        EXPECT_EQ(order[i], i);
+    }
+    // the first run may also include the init task of the queue
+    EXPECT_GE(schedTasks.size(), taskNum / budgetTaskNum);
+    EXPECT_LE(schedTasks.size(), taskNum / budgetTaskNum + 1);
+
+    ffrt_queue_attr_destroy(&queue_attr);
+    ffrt_queue_destroy(queue_handle);
+}
@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <list>
 #include <vector>
 #include <queue>
+#include <sstream>
 #include <thread>
 #include <gtest/gtest.h>
 #define private public
@@ -69,4 +71,387 @@ HWTEST_F(SchedulerTest, ffrt_task_runqueue_test, TestSize.Level0)
     }
     EXPECT_EQ(fifoqueue->Size(), enqCount);
     EXPECT_EQ(fifoqueue->Empty(), false);
-}
\ No newline at end of file
+}
+
+HWTEST_F(SchedulerTest, ffrt_task_priority_runqueue_test, TestSize.Level0)
+{
+    auto queue = std::make_unique<ffrt::PriorityFIFOQueue>();
+    ffrt_task_attr_t attr;
+    ffrt_task_attr_init(&attr);
+    EXPECT_EQ(ffrt_task_attr_get_priority(&attr), ffrt_task_priority_normal);
+    ffrt_task_attr_set_priority(&attr, static_cast<ffrt_task_priority_t>(ffrt_task_priority_low + 1));
+    EXPECT_EQ(ffrt_task_attr_get_priority(&attr), ffrt_task_priority_normal);
+
+    constexpr int normalCount = 20;
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    auto push = [&](ffrt_task_priority_t prio) {
+        ffrt_task_attr_set_priority(&attr, prio);
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(reinterpret_cast<task_attr_private*>(&attr), nullptr, 0));
+        queue->EnQueue(tasks.back().get());
+        return tasks.back().get();
+    };
+    TaskBase* low = push(ffrt_task_priority_low);
+    std::vector<TaskBase*> normals;
+    for (int i = 0; i < normalCount; i++) {
+        normals.push_back(push(ffrt_task_priority_normal));
+    }
+    TaskBase* high = push(ffrt_task_priority_high);
+    EXPECT_EQ(queue->Size(), normalCount + 2);
+
+    // high jumps the queue, normal keeps fifo order, low gets a turn once passed over too often
+    EXPECT_EQ(queue->DeQueue(), high);
+    std::vector<TaskBase*> order;
+    while (!queue->Empty()) {
+        order.push_back(queue->DeQueue());
+    }
+    EXPECT_EQ(queue->DeQueue(), nullptr);
+    ASSERT_EQ(order.size(), normalCount + 1);
+    auto lowPos = std::find(order.begin(), order.end(), low) - order.begin();
+    EXPECT_GT(lowPos, 0);
+    EXPECT_LT(lowPos, normalCount);
+    order.erase(order.begin() + lowPos);
+    EXPECT_EQ(order, normals);
+    ffrt_task_attr_destroy(&attr);
+}
+
+HWTEST_F(SchedulerTest, ffrt_task_priority_submit_test, TestSize.Level0)
+{
+    ffrt::task_attr highAttr;
+    ffrt_task_attr_set_priority(&highAttr, ffrt_task_priority_high);
+    uint8_t highPrio = 0xff;
+    uint8_t normalPrio = 0xff;
+    ffrt::submit([&]() { highPrio = ffrt::ExecuteCtx::Cur()->task->schedPrio_; }, highAttr);
+    ffrt::submit([&]() { normalPrio = ffrt::ExecuteCtx::Cur()->task->schedPrio_; });
+    ffrt::wait();
+    EXPECT_EQ(highPrio, ffrt_task_priority_high);
+    EXPECT_EQ(normalPrio, ffrt_task_priority_normal);
+}
+
+HWTEST_F(SchedulerTest, ffrt_task_edf_runqueue_test, TestSize.Level0)
+{
+    ffrt::EDFQueue queue;
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    constexpr uint64_t deadlines[] = {300, 100, 200, 100};
+    for (uint64_t deadline : deadlines) {
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(nullptr, nullptr, 0));
+        tasks.back()->deadlineUs_ = deadline;
+        queue.EnQueue(tasks.back().get());
+    }
+    EXPECT_EQ(queue.Size(), 4);
+    // earliest deadline first, submission order on ties
+    EXPECT_EQ(queue.DeQueue(), tasks[1].get());
+    EXPECT_EQ(queue.DeQueue(), tasks[3].get());
+    EXPECT_EQ(queue.DeQueue(), tasks[2].get());
+    EXPECT_EQ(queue.DeQueue(), tasks[0].get());
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.DeQueue(), nullptr);
+}
+
+HWTEST_F(SchedulerTest, ffrt_task_deadline_submit_test, TestSize.Level0)
+{
+    EXPECT_EQ(ffrt_set_sched_policy(ffrt_qos_user_initiated, ffrt_sched_policy_edf), ffrt_success);
+    EXPECT_EQ(ffrt_set_sched_policy(ffrt_qos_user_initiated, static_cast<ffrt_sched_policy>(-1)), ffrt_error_inval);
+    EXPECT_EQ(ffrt_set_sched_policy(-2, ffrt_sched_policy_edf), ffrt_error_inval);
+
+    ffrt::task_attr attr;
+    attr.qos(ffrt_qos_user_initiated);
+    ffrt_task_attr_set_deadline(&attr, 1000);
+    EXPECT_EQ(ffrt_task_attr_get_deadline(&attr), 1000);
+
+    uint64_t parentDeadline = 0;
+    uint64_t childDeadline = 1;
+    uint64_t missed = ffrt_get_deadline_miss_count(ffrt_qos_user_initiated);
+    ffrt::submit([&]() {
+        parentDeadline = ffrt::ExecuteCtx::Cur()->task->deadlineUs_;
+        // the child misses the inherited deadline as well, the miss is counted once for the parent
+        ffrt::submit([&]() {
+            childDeadline = ffrt::ExecuteCtx::Cur()->task->deadlineUs_;
+            ffrt::this_task::sleep_for(std::chrono::milliseconds(2));
+        }, ffrt::task_attr().qos(ffrt_qos_user_initiated));
+        ffrt::wait();
+        ffrt::this_task::sleep_for(std::chrono::milliseconds(2));
+    }, attr);
+    ffrt::wait();
+    EXPECT_NE(parentDeadline, 0);
+    EXPECT_EQ(childDeadline, parentDeadline);
+    EXPECT_EQ(ffrt_get_deadline_miss_count(ffrt_qos_user_initiated), missed + 1);
+
+    // tasks submitted from a thread inside an interval inherit its deadline
+    ffrt_interval_t it = ffrt_interval_create(100000, ffrt_qos_user_interactive);
+    ASSERT_NE(it, nullptr);
+    ffrt_interval_begin(it);
+    uint64_t intervalDeadline = ffrt::ExecuteCtx::Cur()->intervalDeadlineUs;
+    EXPECT_NE(intervalDeadline, 0);
+    ffrt::submit([&]() { childDeadline = ffrt::ExecuteCtx::Cur()->task->deadlineUs_; },
+        ffrt::task_attr().qos(ffrt_qos_user_initiated));
+    ffrt::wait();
+    EXPECT_EQ(childDeadline, intervalDeadline);
+    ffrt_interval_end(it);
+    EXPECT_EQ(ffrt::ExecuteCtx::Cur()->intervalDeadlineUs, 0);
+    ffrt_interval_destroy(it);
+    EXPECT_EQ(ffrt_set_sched_policy(ffrt_qos_user_initiated, ffrt_sched_policy_fifo), ffrt_success);
+}
+
+namespace {
+class LifoPolicy : public ffrt::sched_policy {
+public:
+    explicit LifoPolicy(std::atomic<int>* pushCnt = nullptr) : pushCnt_(pushCnt) {}
+
+    void push(const ffrt::ready_task& task) override
+    {
+        if (pushCnt_ != nullptr) {
+            pushCnt_->fetch_add(1);
+        }
+        tasks_.push_back(task);
+    }
+
+    ffrt::ready_task pop() override
+    {
+        if (tasks_.empty()) {
+            return {};
+        }
+        ffrt::ready_task task = tasks_.back();
+        tasks_.pop_back();
+        return task;
+    }
+
+    size_t size() const override
+    {
+        return tasks_.size();
+    }
+
+private:
+    std::vector<ffrt::ready_task> tasks_;
+    std::atomic<int>* pushCnt_;
+};
+} // namespace
+
+HWTEST_F(SchedulerTest, ffrt_custom_sched_policy_test, TestSize.Level0)
+{
+    STaskScheduler scheduler;
+    QoS qos(ffrt_qos_background);
+    scheduler.SetQos(qos);
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    for (int i = 0; i < 3; i++) {
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(nullptr, nullptr, 0));
+    }
+    // queued tasks move over to the policy in fifo order
+    scheduler.PushTask(tasks[0].get(), false);
+    scheduler.PushTask(tasks[1].get(), false);
+    EXPECT_TRUE(scheduler.SetCustomPolicy(std::make_unique<LifoPolicy>()));
+    scheduler.PushTask(tasks[2].get(), false);
+    EXPECT_EQ(scheduler.GetGlobalTaskCnt(), 3);
+    EXPECT_EQ(scheduler.PopTask(), tasks[2].get());
+    EXPECT_EQ(scheduler.StealTask(), tasks[1].get());
+    // and back to the built-in queue
+    scheduler.PushTask(tasks[2].get(), false);
+    EXPECT_TRUE(scheduler.SetCustomPolicy(nullptr));
+    EXPECT_EQ(scheduler.GetGlobalTaskCnt(), 2);
+    EXPECT_EQ(scheduler.PopTask(), tasks[2].get());
+    EXPECT_EQ(scheduler.PopTask(), tasks[0].get());
+    EXPECT_EQ(scheduler.PopTask(), nullptr);
+    EXPECT_TRUE(scheduler.GlobalTaskEmpty());
+
+    std::atomic<int> pushCnt {0};
+    EXPECT_EQ(ffrt::set_sched_policy(-2, nullptr), ffrt_error_inval);
+    EXPECT_EQ(ffrt::set_sched_policy(ffrt_qos_background, std::make_unique<LifoPolicy>(&pushCnt)), ffrt_success);
+    std::atomic<int> runCnt {0};
+    for (int i = 0; i < 100; i++) {
+        ffrt::submit([&]() { runCnt++; }, ffrt::task_attr().qos(ffrt_qos_background));
+    }
+    ffrt::wait();
+    EXPECT_EQ(runCnt.load(), 100);
+    EXPECT_GE(pushCnt.load(), 100);
+    EXPECT_EQ(ffrt::set_sched_policy(ffrt_qos_background, nullptr), ffrt_success);
+}
+
+HWTEST_F(SchedulerTest, ffrt_next_task_chain_test, TestSize.Level0)
+{
+    constexpr int chainLen = 10;
+    int x = 0;
+    std::atomic<bool> submitted {false};
+    std::vector<pid_t> tids(chainLen, 0);
+    ffrt::submit([&] {
+        while (!submitted) {
+            usleep(100);
+        }
+        tids[0] = gettid();
+    }, {}, {&x});
+    for (int i = 1; i < chainLen; i++) {
+        ffrt::submit([&, i] { tids[i] = gettid(); }, {&x}, {&x});
+    }
+    submitted = true;
+    ffrt::wait({&x});
+    for (int i = 1; i < chainLen; i++) {
+        EXPECT_EQ(tids[i], tids[0]);
+    }
+}
+
+HWTEST_F(SchedulerTest, ffrt_next_task_queue_order_test, TestSize.Level0)
+{
+    STaskScheduler scheduler;
+    QoS qos(ffrt_qos_background);
+    scheduler.SetQos(qos);
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    for (auto prio : {ffrt_task_priority_high, ffrt_task_priority_normal, ffrt_task_priority_low}) {
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(nullptr, nullptr, 0));
+        tasks.back()->schedPrio_ = prio;
+    }
+    SCPUEUTask* high = tasks[0].get();
+    SCPUEUTask* normal = tasks[1].get();
+    SCPUEUTask* low = tasks[2].get();
+    EXPECT_TRUE(scheduler.CanRunNext(low));
+
+    // a task readied next must not pass a queued task of a higher priority
+    scheduler.PushTask(normal, false);
+    EXPECT_FALSE(scheduler.CanRunNext(low));
+    EXPECT_TRUE(scheduler.CanRunNext(normal));
+    EXPECT_TRUE(scheduler.CanRunNext(high));
+
+    // nor a queued task with a deadline under edf
+    EXPECT_TRUE(scheduler.SetPolicy(ffrt_sched_policy_edf));
+    EXPECT_EQ(scheduler.PopTask(), normal);
+    normal->deadlineUs_ = 1;
+    scheduler.PushTask(normal, false);
+    EXPECT_FALSE(scheduler.CanRunNext(high));
+    EXPECT_EQ(scheduler.PopTask(), normal);
+    EXPECT_TRUE(scheduler.CanRunNext(high));
+    EXPECT_TRUE(scheduler.SetPolicy(ffrt_sched_policy_fifo));
+
+    // and a custom policy sees every task
+    EXPECT_TRUE(scheduler.SetCustomPolicy(std::make_unique<LifoPolicy>()));
+    EXPECT_FALSE(scheduler.CanRunNext(high));
+    EXPECT_TRUE(scheduler.SetCustomPolicy(nullptr));
+    EXPECT_TRUE(scheduler.CanRunNext(low));
+}
+
+HWTEST_F(SchedulerTest, ffrt_edf_no_deadline_aging_test, TestSize.Level0)
+{
+    STaskScheduler scheduler;
+    QoS qos(ffrt_qos_background);
+    scheduler.SetQos(qos);
+    EXPECT_TRUE(scheduler.SetPolicy(ffrt_sched_policy_edf));
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    auto make = [&](ffrt_task_priority_t prio, uint64_t deadline) {
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(nullptr, nullptr, 0));
+        tasks.back()->schedPrio_ = prio;
+        tasks.back()->deadlineUs_ = deadline;
+        return tasks.back().get();
+    };
+    SCPUEUTask* high = make(ffrt_task_priority_high, 0);
+    SCPUEUTask* low = make(ffrt_task_priority_low, 0);
+    scheduler.PushTask(high, false);
+    scheduler.PushTask(low, false);
+
+    // deadline tasks keep arriving and mostly go first, yet the tasks without a deadline still get their turn
+    constexpr int rounds = 64;
+    std::vector<TaskBase*> order;
+    for (int i = 0; i < rounds; i++) {
+        scheduler.PushTask(make(ffrt_task_priority_normal, i + 1), false);
+        order.push_back(scheduler.PopTask());
+    }
+    auto highPos = std::find(order.begin(), order.end(), high) - order.begin();
+    auto lowPos = std::find(order.begin(), order.end(), low) - order.begin();
+    EXPECT_GT(highPos, 0);
+    EXPECT_LT(highPos, rounds / 2);
+    EXPECT_GT(lowPos, 0);
+    EXPECT_LT(lowPos, rounds / 2);
+
+    while (scheduler.PopTask() != nullptr) {
+    }
+    EXPECT_TRUE(scheduler.SetPolicy(ffrt_sched_policy_fifo));
+}
+
+HWTEST_F(SchedulerTest, ffrt_affinity_hint_runqueue_test, TestSize.Level0)
+{
+    ffrt::AffinityHintQueue queue;
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    constexpr uint64_t hints[] = {1ULL << 1, 1ULL << 2, 1ULL << 1};
+    for (uint64_t hint : hints) {
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(nullptr, nullptr, 0));
+        tasks.back()->affinityHint_ = hint;
+        queue.EnQueue(tasks.back().get());
+    }
+    EXPECT_EQ(queue.Size(), 3);
+    // the first task preferring the cpu is taken, none is taken for a cpu no task prefers
+    EXPECT_EQ(queue.DeQueue(2, false), tasks[1].get());
+    EXPECT_EQ(queue.DeQueue(3, false), nullptr);
+    EXPECT_EQ(queue.DeQueue(-1, false), nullptr);
+    // the hint is ignored once no other task is ready
+    EXPECT_EQ(queue.DeQueue(3, true), tasks[0].get());
+    // or once the head has been passed over too often
+    TaskBase* head = nullptr;
+    for (int i = 0; i < 16 && head == nullptr; i++) {
+        head = queue.DeQueue(3, false);
+    }
+    EXPECT_EQ(head, tasks[2].get());
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.DeQueue(1, true), nullptr);
+}
+
+HWTEST_F(SchedulerTest, ffrt_affinity_hint_priority_runqueue_test, TestSize.Level0)
+{
+    ffrt::PriorityFIFOQueue queue;
+    std::vector<std::unique_ptr<SCPUEUTask>> tasks;
+    auto push = [&](ffrt_task_priority_t prio, uint64_t hint) {
+        tasks.emplace_back(std::make_unique<SCPUEUTask>(nullptr, nullptr, 0));
+        tasks.back()->schedPrio_ = prio;
+        tasks.back()->affinityHint_ = hint;
+        queue.EnQueue(tasks.back().get());
+        return tasks.back().get();
+    };
+    // a hint does not lift a task over a higher priority
+    TaskBase* lowHinted = push(ffrt_task_priority_low, 1ULL << 1);
+    TaskBase* high = push(ffrt_task_priority_high, 0);
+    EXPECT_TRUE(queue.HintedQueued());
+    EXPECT_TRUE(queue.HigherQueued(ffrt_task_priority_normal));
+    EXPECT_EQ(queue.Size(), 2);
+    EXPECT_EQ(queue.DeQueue(1), high);
+    EXPECT_EQ(queue.DeQueue(1), lowHinted);
+    EXPECT_FALSE(queue.HintedQueued());
+
+    // tasks preferring the cpu go first within a priority, but cannot starve the ones without a hint
+    constexpr int hintedCnt = 20;
+    TaskBase* plain = push(ffrt_task_priority_normal, 0);
+    for (int i = 0; i < hintedCnt; i++) {
+        push(ffrt_task_priority_normal, 1ULL << 1);
+    }
+    std::vector<TaskBase*> order;
+    while (!queue.Empty()) {
+        order.push_back(queue.DeQueue(1));
+    }
+    ASSERT_EQ(order.size(), hintedCnt + 1);
+    auto plainPos = std::find(order.begin(), order.end(), plain) - order.begin();
+    EXPECT_GT(plainPos, 0);
+    EXPECT_LT(plainPos, hintedCnt);
+}
+
+HWTEST_F(SchedulerTest, ffrt_affinity_hint_submit_test, TestSize.Level0)
+{
+    ffrt::task_attr attr;
+    attr.qos(ffrt_qos_utility);
+    ffrt_task_attr_set_affinity_hint(&attr, 1);
+    EXPECT_EQ(ffrt_task_attr_get_affinity_hint(&attr), 1);
+    TaskScheduler& sched = FFRTFacade::GetScheduler().GetScheduler(QoS(ffrt_qos_utility));
+    uint64_t hinted = sched.affinityHintCnt.load();
+    constexpr int taskCnt = 20;
+    std::atomic<int> runCnt {0};
+    uint64_t taskHint = 0;
+    for (int i = 0; i < taskCnt; i++) {
+        ffrt::submit([&] {
+            taskHint = ffrt::ExecuteCtx::Cur()->task->affinityHint_;
+            runCnt++;
+        }, attr);
+    }
+    ffrt::wait();
+    EXPECT_EQ(runCnt.load(), taskCnt);
+    EXPECT_EQ(taskHint, 1);
+    EXPECT_EQ(sched.affinityHintCnt.load(), hinted + taskCnt);
+    EXPECT_LE(sched.affinityHintHitCnt.load(), sched.affinityHintCnt.load());
+
+    char dumpinfo[1024 * 4] = {0};
+    EXPECT_GT(ffrt_dump(DUMP_AFFINITY_HINT_INFO, dumpinfo, sizeof(dumpinfo)), 0);
+    std::ostringstream line;
+    line << "\n" << static_cast<int>(ffrt_qos_utility) << " " << sched.affinityHintCnt.load() << " ";
+    EXPECT_NE(std::string(dumpinfo).find(line.str()), std::string::npos);
+}